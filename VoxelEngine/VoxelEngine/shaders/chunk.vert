@@ -1,15 +1,45 @@
 #version 460 core
 
-layout (location = 0) in vec3 in_position;
-layout (location = 1) in vec3 in_textureCoordinates;
+layout (location = 0) in uint in_packedVertex;
+layout (location = 1) in vec3 in_chunkPosition;
 
 layout (location = 0) out vec3 v_textureCoordinates;
 
-uniform mat4 u_MVP;
+layout (std140, binding = 0) uniform FrameUniforms
+{
+	mat4 u_View;
+	mat4 u_Projection;
+	mat4 u_ViewProjection;
+	mat4 u_OrthographicProjection;
+	vec3 u_CameraPosition;
+	float u_Time;
+};
+
+const vec3 TextureUAxes[6] = vec3[](
+	vec3(0.0, 0.0, 1.0),
+	vec3(0.0, 0.0, -1.0),
+	vec3(1.0, 0.0, 0.0),
+	vec3(1.0, 0.0, 0.0),
+	vec3(-1.0, 0.0, 0.0),
+	vec3(1.0, 0.0, 0.0)
+);
+
+const vec3 TextureVAxes[6] = vec3[](
+	vec3(0.0, 1.0, 0.0),
+	vec3(0.0, 1.0, 0.0),
+	vec3(0.0, 0.0, 1.0),
+	vec3(0.0, 0.0, 1.0),
+	vec3(0.0, 1.0, 0.0),
+	vec3(0.0, 1.0, 0.0)
+);
 
 void main()
 {
-	v_textureCoordinates = in_textureCoordinates;
+	const vec3 localPosition = vec3(in_packedVertex & 0x1Fu, (in_packedVertex >> 5u) & 0x1Fu, (in_packedVertex >> 10u) & 0x1Fu);
+	const uint normalIndex = (in_packedVertex >> 15u) & 0x7u;
+	const float tileIndex = float(in_packedVertex >> 18u);
+
+	v_textureCoordinates = vec3(dot(localPosition, TextureUAxes[normalIndex]), dot(localPosition, TextureVAxes[normalIndex]), tileIndex);
 
-	gl_Position = u_MVP * vec4(in_position, 1.0);
+	gl_Position = u_ViewProjection * vec4(in_chunkPosition + localPosition, 1.0);
 }
\ No newline at end of file
@@ -4,12 +4,20 @@ layout (location = 0) in vec3 in_position;
 
 layout (location = 0) out vec3 v_textureCoordinates;
 
-uniform mat4 u_ViewProjection;
+layout (std140, binding = 0) uniform FrameUniforms
+{
+	mat4 u_View;
+	mat4 u_Projection;
+	mat4 u_ViewProjection;
+	mat4 u_OrthographicProjection;
+	vec3 u_CameraPosition;
+	float u_Time;
+};
 
 void main()
 {
 	v_textureCoordinates = in_position;
 	v_textureCoordinates.y *= -1.0;
 
-	gl_Position = (u_ViewProjection * vec4(in_position, 1.0)).xyww;
+	gl_Position = (u_Projection * mat4(mat3(u_View)) * vec4(in_position, 1.0)).xyww;
 }
\ No newline at end of file
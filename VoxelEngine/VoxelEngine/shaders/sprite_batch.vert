@@ -0,0 +1,26 @@
+#version 460 core
+
+layout (location = 0) in vec2 in_position;
+layout (location = 1) in vec2 in_textureCoordinates;
+layout (location = 2) in vec4 in_colour;
+
+layout (location = 0) out vec2 v_textureCoordinates;
+layout (location = 1) out vec4 v_colour;
+
+layout (std140, binding = 0) uniform FrameUniforms
+{
+	mat4 u_View;
+	mat4 u_Projection;
+	mat4 u_ViewProjection;
+	mat4 u_OrthographicProjection;
+	vec3 u_CameraPosition;
+	float u_Time;
+};
+
+void main()
+{
+	v_textureCoordinates = in_textureCoordinates;
+	v_colour = in_colour;
+	
+	gl_Position = u_OrthographicProjection * vec4(in_position, 0.0, 1.0);
+}
\ No newline at end of file
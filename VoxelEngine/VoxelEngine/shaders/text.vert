@@ -5,10 +5,18 @@ layout (location = 1) in vec2 in_textureCoordinates;
 
 out vec2 v_textureCoordinates;
 
-uniform mat4 u_Projection;
+layout (std140, binding = 0) uniform FrameUniforms
+{
+	mat4 u_View;
+	mat4 u_Projection;
+	mat4 u_ViewProjection;
+	mat4 u_OrthographicProjection;
+	vec3 u_CameraPosition;
+	float u_Time;
+};
 
 void main()
 {
 	v_textureCoordinates = in_textureCoordinates;
-	gl_Position = u_Projection * vec4(in_position, 0.0, 1.0);
+	gl_Position = u_OrthographicProjection * vec4(in_position, 0.0, 1.0);
 }
\ No newline at end of file
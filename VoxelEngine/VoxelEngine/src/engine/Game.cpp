@@ -20,6 +20,7 @@
 #include <vector>
 
 #include "error/GameException.h"
+#include "graphics/RenderState.h"
 #include "utility/config/ConfigReader.h"
 
 #ifdef _WIN32
@@ -49,6 +50,8 @@ void Game::Play()
 	m_isRunning = !m_scenes.empty();
 	SDL_Event gameEvent{ };
 
+	m_timestep->Reset();
+
 	while (m_isRunning)
 	{
 		PollEvents(gameEvent);
@@ -67,15 +70,17 @@ void Game::FinishCurrentScene()
 
 void Game::Initialise()
 {
-	const Config config = ConfigReader().ReadConfigFile();
+	m_config = ConfigReader().ReadConfigFile();
 
-	InitialiseSDL(config);
-	InitialiseWindow(config);
+	InitialiseSDL(m_config);
+	InitialiseWindow(m_config);
 	InitialiseGLAD();
 	InitialiseOpenGL();
 	InitialiseAudio();
 	InitialiseGameController();
 
+	m_timestep = std::make_unique<FixedTimestep>(m_config.updateRate);
+
 	stbi_set_flip_vertically_on_load(true);
 	stbi_flip_vertically_on_write(true);
 }
@@ -168,17 +173,17 @@ void Game::InitialiseGLAD() const
 
 void Game::InitialiseOpenGL() const
 {
-	glEnable(GL_DEPTH_TEST);
+	RenderState::SetCapability(GL_DEPTH_TEST, true);
 	glDepthFunc(GL_LEQUAL);
 
-	glEnable(GL_BLEND);
+	RenderState::SetCapability(GL_BLEND, true);
 	glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
 
-	glEnable(GL_CULL_FACE);
+	RenderState::SetCapability(GL_CULL_FACE, true);
 	glCullFace(GL_BACK);
 	glFrontFace(GL_CCW);
 
-	glEnable(GL_MULTISAMPLE);
+	RenderState::SetCapability(GL_MULTISAMPLE, true);
 
 	glViewport(0, 0, m_window->GetSize().x, m_window->GetSize().y);
 	glClearColor(0.0f, 0.0f, 0.0f, 1.0f);
@@ -247,6 +252,7 @@ void Game::PollEvents(SDL_Event& gameEvent)
 				if (!m_hasFocus)
 				{
 					m_hasFocus = true;
+					m_timestep->Reset();
 				}
 
 				SDL_GetRelativeMouseState(nullptr, nullptr);
@@ -309,11 +315,16 @@ void Game::ProcessInput()
 
 void Game::Update()
 {
-	const float deltaTime = CalculateDeltaTime();
+	const unsigned int updateCount = m_timestep->BeginFrame();
 
 	if (m_hasFocus)
 	{
-		m_scenes.front()->Update(deltaTime);
+		for (unsigned int i = 0; i < updateCount; ++i)
+		{
+			m_scenes.front()->Update(m_timestep->GetStepTime());
+		}
+
+		m_scenes.front()->LateUpdate();
 	}
 }
 
@@ -323,9 +334,10 @@ void Game::Render() const
 	{
 		glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
 
-		m_scenes.front()->Render();
+		m_scenes.front()->Render(m_timestep->GetInterpolationAlpha());
 
 		m_window->SwapBuffers();
+		RenderState::EndFrame();
 	}
 }
 
@@ -345,16 +357,6 @@ void Game::UpdateSceneQueue()
 	}
 }
 
-float Game::CalculateDeltaTime()
-{
-	constexpr float MillisecondsPerSecond = 1000.0f;
-
-	const float deltaTime = static_cast<float>(SDL_GetTicks() - m_ticksCount) / MillisecondsPerSecond;
-	m_ticksCount = SDL_GetTicks();
-
-	return deltaTime;
-}
-
 void Game::TakeScreenshot() const
 {
 	constexpr size_t PixelChannelCount = 3u;
@@ -18,16 +18,19 @@
 #include "managers/input/InputManager.h"
 #include "scenes/GameScene.h"
 #include "utility/config/Config.h"
+#include "utility/FixedTimestep.h"
 
 class Game final
 	: private INoncopyable, private INonmovable
 {
 private:
+	Config m_config;
+
 	std::unique_ptr<GLWindow> m_window = nullptr;
 	bool m_hasFocus = true;
 
 	bool m_isRunning = true;
-	Uint32 m_ticksCount = 0;
+	std::unique_ptr<FixedTimestep> m_timestep = nullptr;
 	
 	std::queue<std::unique_ptr<GameScene>> m_scenes;
 	bool m_isCurrentSceneFinished = false;
@@ -52,7 +55,9 @@ public:
 
 	void FinishCurrentScene();
 
+	inline const Config& GetConfig() const noexcept { return m_config; }
 	inline const glm::uvec2& GetWindowSize() const noexcept { return m_window->GetSize(); }
+	inline const FixedTimestep::Statistics& GetFrameStatistics() const noexcept { return m_timestep->GetStatistics(); }
 
 private:
 	void Initialise();
@@ -70,8 +75,6 @@ private:
 
 	void UpdateSceneQueue();
 
-	float CalculateDeltaTime();
-
 	void TakeScreenshot() const;
 	void ProcessWindowResize(const glm::uvec2& newSize);
 };
@@ -4,7 +4,7 @@
 #include <limits>
 
 Camera3D::Camera3D(const glm::vec3& position, const glm::vec3& up, const float yaw, const float pitch)
-	: m_position(position), m_worldUp(up), m_yaw(yaw), m_pitch(pitch)
+	: m_position(position), m_previousPosition(position), m_worldUp(up), m_yaw(yaw), m_pitch(pitch)
 {
 	UpdateVectors();
 }
@@ -67,12 +67,20 @@ void Camera3D::ProcessInput(const KeyboardState& keyboardState, const MouseState
 
 void Camera3D::Update(const float deltaTime)
 {
+	m_previousPosition = m_position;
 	m_position += m_velocity * deltaTime;
 }
 
 void Camera3D::Render() const
 { }
 
+glm::mat4 Camera3D::GetInterpolatedViewMatrix(const float interpolation) const noexcept
+{
+	const glm::vec3 interpolatedPosition = GetInterpolatedPosition(interpolation);
+
+	return glm::lookAt(interpolatedPosition, interpolatedPosition + m_front, m_up);
+}
+
 void Camera3D::UpdateVectors()
 {
 	glm::vec3 updatedFront{
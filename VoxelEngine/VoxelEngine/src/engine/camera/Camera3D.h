@@ -18,6 +18,7 @@ private:
 	static constexpr float s_DefaultZoom = 45.0f;
 
 	glm::vec3 m_position{ 0.0f, 0.0f, 0.0f };
+	glm::vec3 m_previousPosition{ 0.0f, 0.0f, 0.0f };
 	glm::vec3 m_front{ 0.0f, 0.0f, 0.0f };
 	glm::vec3 m_up{ 0.0f, 1.0f, 0.0f };
 	glm::vec3 m_right{ 0.0f, 0.0f, 0.0f };
@@ -44,6 +45,8 @@ public:
 	inline const glm::vec3& GetPosition() const noexcept { return m_position; }
 	inline const glm::vec3& GetFront() const noexcept { return m_front; }
 	inline glm::mat4 GetViewMatrix() const noexcept { return glm::lookAt(m_position, m_position + m_front, m_up); }
+	inline glm::vec3 GetInterpolatedPosition(const float interpolation) const noexcept { return glm::mix(m_previousPosition, m_position, interpolation); }
+	glm::mat4 GetInterpolatedViewMatrix(const float interpolation) const noexcept;
 
 private:
 	void UpdateVectors();
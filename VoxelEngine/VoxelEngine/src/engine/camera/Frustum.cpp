@@ -0,0 +1,37 @@
+#include "Frustum.h"
+
+Frustum::Frustum(const glm::mat4& viewProjectionMatrix) noexcept
+{
+	const glm::mat4 rows = glm::transpose(viewProjectionMatrix);
+
+	m_planes[0] = rows[3] + rows[0];
+	m_planes[1] = rows[3] - rows[0];
+	m_planes[2] = rows[3] + rows[1];
+	m_planes[3] = rows[3] - rows[1];
+	m_planes[4] = rows[3] + rows[2];
+	m_planes[5] = rows[3] - rows[2];
+
+	for (auto& plane : m_planes)
+	{
+		plane /= glm::length(glm::vec3(plane));
+	}
+}
+
+bool Frustum::IsBoxVisible(const glm::vec3& minimum, const glm::vec3& maximum) const noexcept
+{
+	for (const auto& plane : m_planes)
+	{
+		const glm::vec3 positiveVertex{
+			plane.x >= 0.0f ? maximum.x : minimum.x,
+			plane.y >= 0.0f ? maximum.y : minimum.y,
+			plane.z >= 0.0f ? maximum.z : minimum.z
+		};
+
+		if (glm::dot(glm::vec3(plane), positiveVertex) + plane.w < 0.0f)
+		{
+			return false;
+		}
+	}
+
+	return true;
+}
\ No newline at end of file
@@ -0,0 +1,21 @@
+#pragma once
+#ifndef FRUSTUM_H
+#define FRUSTUM_H
+
+#include <glm/glm.hpp>
+
+#include <array>
+
+class Frustum
+{
+private:
+	std::array<glm::vec4, 6u> m_planes;
+
+public:
+	explicit Frustum(const glm::mat4& viewProjectionMatrix) noexcept;
+	~Frustum() noexcept = default;
+
+	bool IsBoxVisible(const glm::vec3& minimum, const glm::vec3& maximum) const noexcept;
+};
+
+#endif
\ No newline at end of file
@@ -9,6 +9,7 @@
 #include <utility>
 
 #include "../error/GameException.h"
+#include "RenderState.h"
 
 Cubemap::Cubemap(const std::string& filepath)
 {
@@ -45,7 +46,7 @@ Cubemap::~Cubemap() noexcept
 
 void Cubemap::Bind() const
 {
-	glBindTexture(GL_TEXTURE_CUBE_MAP, m_id);
+	RenderState::BindTexture(GL_TEXTURE_CUBE_MAP, m_id);
 }
 
 void Cubemap::Generate(const std::string& filepath)
@@ -106,11 +107,12 @@ void Cubemap::SetupParameters(const GLint internalFormat, const GLenum format)
 	glGetFloatv(GL_MAX_TEXTURE_MAX_ANISOTROPY, &maxAnisotropy);
 	glTexParameterf(GL_TEXTURE_CUBE_MAP, GL_TEXTURE_MAX_ANISOTROPY, maxAnisotropy);
 
-	glBindTexture(GL_TEXTURE_CUBE_MAP, 0);
+	RenderState::BindTexture(GL_TEXTURE_CUBE_MAP, 0);
 }
 
 void Cubemap::Destroy() noexcept
 {
+	RenderState::OnTextureDeleted(m_id);
 	glDeleteTextures(1, &m_id);
 	m_id = 0;
 }
@@ -2,6 +2,8 @@
 
 #include <utility>
 
+#include "RenderState.h"
+
 Drawable::Drawable()
 {
 	glGenVertexArrays(1, &m_vao);
@@ -46,6 +48,7 @@ void Drawable::DestroyVertexArray() noexcept
 {
 	if (m_vao != 0)
 	{
+		RenderState::OnVertexArrayDeleted(m_vao);
 		glDeleteVertexArrays(1, &m_vao);
 		m_vao = 0;
 	}
@@ -0,0 +1,42 @@
+#include "QuadElementBuffer.h"
+
+#include <vector>
+
+#include "RenderState.h"
+
+QuadElementBuffer::QuadElementBuffer(const size_t quadCapacity)
+	: m_quadCapacity(quadCapacity)
+{
+	std::vector<GLuint> elements;
+	elements.reserve(GetElementCount(m_quadCapacity));
+
+	for (size_t quad = 0; quad < m_quadCapacity; ++quad)
+	{
+		const GLuint firstVertex = static_cast<GLuint>(quad) * s_VerticesPerQuad;
+
+		for (const GLuint corner : s_QuadPattern)
+		{
+			elements.push_back(firstVertex + corner);
+		}
+	}
+
+	glGenBuffers(1, &m_id);
+	RenderState::BindVertexArray(0);
+	glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, m_id);
+	glBufferData(GL_ELEMENT_ARRAY_BUFFER, elements.size() * sizeof(GLuint), elements.data(), GL_STATIC_DRAW);
+	glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, 0);
+}
+
+QuadElementBuffer::~QuadElementBuffer() noexcept
+{
+	if (m_id != 0)
+	{
+		glDeleteBuffers(1, &m_id);
+		m_id = 0;
+	}
+}
+
+void QuadElementBuffer::Bind() const
+{
+	glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, m_id);
+}
\ No newline at end of file
@@ -0,0 +1,37 @@
+#pragma once
+#ifndef QUAD_ELEMENT_BUFFER_H
+#define QUAD_ELEMENT_BUFFER_H
+
+#include "../interfaces/INoncopyable.h"
+#include "../interfaces/INonmovable.h"
+
+#include <glad/glad.h>
+
+#include <array>
+#include <cstddef>
+
+class QuadElementBuffer
+	: private INoncopyable, private INonmovable
+{
+private:
+	static constexpr std::array<GLuint, 6u> s_QuadPattern{ 0u, 2u, 1u, 2u, 3u, 1u };
+	static constexpr GLuint s_VerticesPerQuad = 4u;
+
+	GLuint m_id = 0;
+	size_t m_quadCapacity = 0;
+
+public:
+	static constexpr GLenum GetElementType() noexcept { return GL_UNSIGNED_INT; }
+	static constexpr size_t GetElementCount(const size_t quadCount) noexcept { return quadCount * s_QuadPattern.size(); }
+
+	explicit QuadElementBuffer(const size_t quadCapacity);
+	~QuadElementBuffer() noexcept;
+
+	void Bind() const;
+
+	inline GLuint GetID() const noexcept { return m_id; }
+	inline size_t GetQuadCapacity() const noexcept { return m_quadCapacity; }
+	inline size_t GetMemoryUsage() const noexcept { return GetElementCount(m_quadCapacity) * sizeof(GLuint); }
+};
+
+#endif
\ No newline at end of file
@@ -0,0 +1,137 @@
+#include "RenderState.h"
+
+#include <algorithm>
+#include <iterator>
+
+RenderState::Statistics RenderState::s_frameStatistics;
+RenderState::Statistics RenderState::s_lastFrameStatistics;
+
+void RenderState::UseProgram(const GLuint program)
+{
+	if (ShouldIssueCall(program == s_program))
+	{
+		glUseProgram(program);
+		s_program = program;
+	}
+}
+
+void RenderState::BindVertexArray(const GLuint vertexArray)
+{
+	if (ShouldIssueCall(vertexArray == s_vertexArray))
+	{
+		glBindVertexArray(vertexArray);
+		s_vertexArray = vertexArray;
+	}
+}
+
+void RenderState::SetActiveTextureUnit(const GLenum textureUnit)
+{
+	if (ShouldIssueCall(textureUnit == s_activeTextureUnit))
+	{
+		glActiveTexture(textureUnit);
+		s_activeTextureUnit = textureUnit;
+	}
+}
+
+void RenderState::BindTexture(const GLenum target, const GLuint texture)
+{
+	const size_t unitIndex = static_cast<size_t>(s_activeTextureUnit - GL_TEXTURE0);
+	const size_t targetIndex = GetTextureTargetIndex(target);
+
+	if (unitIndex >= s_TextureUnitCount || targetIndex >= s_TextureTargets.size())
+	{
+		ShouldIssueCall(false);
+		glBindTexture(target, texture);
+
+		return;
+	}
+
+	if (GLuint& boundTexture = s_textures[unitIndex][targetIndex];
+		ShouldIssueCall(texture == boundTexture))
+	{
+		glBindTexture(target, texture);
+		boundTexture = texture;
+	}
+}
+
+void RenderState::SetCapability(const GLenum capability, const bool isEnabled)
+{
+	const auto location = s_capabilities.find(capability);
+
+	if (ShouldIssueCall(location != std::cend(s_capabilities) && location->second == isEnabled))
+	{
+		if (isEnabled)
+		{
+			glEnable(capability);
+		}
+		else
+		{
+			glDisable(capability);
+		}
+
+		s_capabilities[capability] = isEnabled;
+	}
+}
+
+bool RenderState::IsCapabilityEnabled(const GLenum capability)
+{
+	if (const auto location = s_capabilities.find(capability);
+		location != std::cend(s_capabilities))
+	{
+		return location->second;
+	}
+
+	const bool isEnabled = glIsEnabled(capability) == GL_TRUE;
+	s_capabilities[capability] = isEnabled;
+
+	return isEnabled;
+}
+
+void RenderState::OnProgramDeleted(const GLuint program) noexcept
+{
+	if (program == s_program)
+	{
+		s_program = 0;
+	}
+}
+
+void RenderState::OnVertexArrayDeleted(const GLuint vertexArray) noexcept
+{
+	if (vertexArray == s_vertexArray)
+	{
+		s_vertexArray = 0;
+	}
+}
+
+void RenderState::OnTextureDeleted(const GLuint texture) noexcept
+{
+	for (auto& unitTextures : s_textures)
+	{
+		std::replace(std::begin(unitTextures), std::end(unitTextures), texture, GLuint{ 0 });
+	}
+}
+
+void RenderState::EndFrame() noexcept
+{
+	s_lastFrameStatistics = s_frameStatistics;
+	s_frameStatistics = Statistics{ };
+}
+
+size_t RenderState::GetTextureTargetIndex(const GLenum target) noexcept
+{
+	return static_cast<size_t>(std::distance(std::cbegin(s_TextureTargets), std::find(std::cbegin(s_TextureTargets), std::cend(s_TextureTargets), target)));
+}
+
+bool RenderState::ShouldIssueCall(const bool isRedundant) noexcept
+{
+	if (isRedundant)
+	{
+		++s_frameStatistics.skippedCallCount;
+	}
+	else
+	{
+		++s_frameStatistics.issuedCallCount;
+	}
+
+	return !isRedundant;
+}
\ No newline at end of file
@@ -0,0 +1,56 @@
+#pragma once
+#ifndef RENDER_STATE_H
+#define RENDER_STATE_H
+
+#include <glad/glad.h>
+
+#include <array>
+#include <cstddef>
+#include <unordered_map>
+
+class RenderState
+{
+public:
+	struct Statistics
+	{
+		size_t issuedCallCount = 0;
+		size_t skippedCallCount = 0;
+	};
+
+private:
+	static constexpr size_t s_TextureUnitCount = 16u;
+	static constexpr std::array<GLenum, 3u> s_TextureTargets{ GL_TEXTURE_2D, GL_TEXTURE_2D_ARRAY, GL_TEXTURE_CUBE_MAP };
+
+	inline static GLuint s_program = 0;
+	inline static GLuint s_vertexArray = 0;
+	inline static GLenum s_activeTextureUnit = GL_TEXTURE0;
+	inline static std::array<std::array<GLuint, s_TextureTargets.size()>, s_TextureUnitCount> s_textures{ };
+	inline static std::unordered_map<GLenum, bool> s_capabilities;
+
+	static Statistics s_frameStatistics;
+	static Statistics s_lastFrameStatistics;
+
+public:
+	RenderState() = delete;
+	~RenderState() noexcept = delete;
+
+	static void UseProgram(const GLuint program);
+	static void BindVertexArray(const GLuint vertexArray);
+	static void SetActiveTextureUnit(const GLenum textureUnit);
+	static void BindTexture(const GLenum target, const GLuint texture);
+	static void SetCapability(const GLenum capability, const bool isEnabled);
+	static bool IsCapabilityEnabled(const GLenum capability);
+
+	static void OnProgramDeleted(const GLuint program) noexcept;
+	static void OnVertexArrayDeleted(const GLuint vertexArray) noexcept;
+	static void OnTextureDeleted(const GLuint texture) noexcept;
+
+	static void EndFrame() noexcept;
+	static inline const Statistics& GetLastFrameStatistics() noexcept { return s_lastFrameStatistics; }
+
+private:
+	static size_t GetTextureTargetIndex(const GLenum target) noexcept;
+	static bool ShouldIssueCall(const bool isRedundant) noexcept;
+};
+
+#endif
\ No newline at end of file
@@ -0,0 +1,229 @@
+#include "SpriteBatch.h"
+
+#include <algorithm>
+#include <cmath>
+#include <iterator>
+
+#include "RenderState.h"
+
+SpriteBatch::SpriteBatch(const ShaderProgram& shader, const size_t spritesPerRegion)
+	: m_shader(&shader), m_spritesPerRegion(std::max<size_t>(spritesPerRegion, 1)), m_quadElementBuffer(m_spritesPerRegion)
+{
+	InitialiseVertexObjects();
+}
+
+SpriteBatch::~SpriteBatch() noexcept
+{
+	for (GLsync& fence : m_regionFences)
+	{
+		if (fence != nullptr)
+		{
+			glDeleteSync(fence);
+			fence = nullptr;
+		}
+	}
+
+	glBindBuffer(GL_ARRAY_BUFFER, m_vbo);
+	glUnmapBuffer(GL_ARRAY_BUFFER);
+	glBindBuffer(GL_ARRAY_BUFFER, 0);
+
+	glDeleteBuffers(1, &m_vbo);
+
+	RenderState::OnVertexArrayDeleted(m_vao);
+	glDeleteVertexArrays(1, &m_vao);
+}
+
+void SpriteBatch::Begin()
+{
+	m_statistics = Statistics{ };
+	m_isDrawing = true;
+	m_wasDepthTestEnabled = RenderState::IsCapabilityEnabled(GL_DEPTH_TEST);
+}
+
+void SpriteBatch::Draw(const Texture& texture, const glm::vec2& position, const glm::vec2& size, const float rotation, const glm::vec4& colour, const glm::vec2& textureMin, const glm::vec2& textureMax)
+{
+	if (!m_isDrawing)
+	{
+		return;
+	}
+
+	const glm::vec2 halfSize = size * 0.5f;
+	const glm::vec2 centre = position + halfSize;
+
+	const float sine = rotation == 0.0f ? 0.0f : std::sin(rotation);
+	const float cosine = rotation == 0.0f ? 1.0f : std::cos(rotation);
+
+	const auto transformCorner = [&](const glm::vec2& corner) -> glm::vec2
+	{
+		const glm::vec2 offset = corner * size - halfSize;
+
+		return centre + glm::vec2{ offset.x * cosine - offset.y * sine, offset.x * sine + offset.y * cosine };
+	};
+
+	GetTextureBucket(texture.GetID()).sprites.push_back(SpriteVertices{
+		SpriteVertex{ transformCorner(glm::vec2{ 0.0f, 0.0f }), glm::vec2{ textureMin.x, textureMin.y }, colour },
+		SpriteVertex{ transformCorner(glm::vec2{ 1.0f, 0.0f }), glm::vec2{ textureMax.x, textureMin.y }, colour },
+		SpriteVertex{ transformCorner(glm::vec2{ 0.0f, 1.0f }), glm::vec2{ textureMin.x, textureMax.y }, colour },
+		SpriteVertex{ transformCorner(glm::vec2{ 1.0f, 1.0f }), glm::vec2{ textureMax.x, textureMax.y }, colour }
+	});
+}
+
+void SpriteBatch::End()
+{
+	m_isDrawing = false;
+
+	m_textureBuckets.erase(std::remove_if(std::begin(m_textureBuckets), std::end(m_textureBuckets), [](const TextureBucket& bucket)
+	{
+		return bucket.sprites.empty();
+	}), std::end(m_textureBuckets));
+
+	if (m_textureBuckets.empty())
+	{
+		m_lastStatistics = m_statistics;
+
+		return;
+	}
+
+	std::sort(std::begin(m_textureBuckets), std::end(m_textureBuckets), [](const TextureBucket& lhs, const TextureBucket& rhs)
+	{
+		return lhs.textureID < rhs.textureID;
+	});
+
+	m_shader->Use();
+	RenderState::SetActiveTextureUnit(GL_TEXTURE0);
+	RenderState::SetCapability(GL_DEPTH_TEST, false);
+	RenderState::BindVertexArray(m_vao);
+
+	WaitForRegion(m_regionIndex);
+
+	for (TextureBucket& bucket : m_textureBuckets)
+	{
+		DrawTextureBucket(bucket);
+
+		m_statistics.spriteCount += bucket.sprites.size();
+		bucket.sprites.clear();
+	}
+
+	AdvanceRegion();
+
+	RenderState::SetCapability(GL_DEPTH_TEST, m_wasDepthTestEnabled);
+
+	m_lastBucketIndex = 0;
+	m_lastStatistics = m_statistics;
+}
+
+void SpriteBatch::InitialiseVertexObjects()
+{
+	constexpr GLbitfield MapFlags = GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT;
+	const GLsizeiptr bufferSize = static_cast<GLsizeiptr>(s_RegionCount * m_spritesPerRegion * s_VerticesPerSprite * sizeof(SpriteVertex));
+
+	glGenVertexArrays(1, &m_vao);
+	glGenBuffers(1, &m_vbo);
+
+	RenderState::BindVertexArray(m_vao);
+
+	glBindBuffer(GL_ARRAY_BUFFER, m_vbo);
+	glBufferStorage(GL_ARRAY_BUFFER, bufferSize, nullptr, MapFlags);
+	m_mappedVertices = static_cast<SpriteVertex*>(glMapBufferRange(GL_ARRAY_BUFFER, 0, bufferSize, MapFlags));
+
+	glEnableVertexAttribArray(Position);
+	glVertexAttribPointer(Position, 2, GL_FLOAT, GL_FALSE, sizeof(SpriteVertex), reinterpret_cast<const GLvoid*>(offsetof(SpriteVertex, position)));
+
+	glEnableVertexAttribArray(TextureCoordinates);
+	glVertexAttribPointer(TextureCoordinates, 2, GL_FLOAT, GL_FALSE, sizeof(SpriteVertex), reinterpret_cast<const GLvoid*>(offsetof(SpriteVertex, textureCoordinates)));
+
+	glEnableVertexAttribArray(Colour);
+	glVertexAttribPointer(Colour, 4, GL_FLOAT, GL_FALSE, sizeof(SpriteVertex), reinterpret_cast<const GLvoid*>(offsetof(SpriteVertex, colour)));
+
+	m_quadElementBuffer.Bind();
+
+	RenderState::BindVertexArray(0);
+	glBindBuffer(GL_ARRAY_BUFFER, 0);
+	glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, 0);
+}
+
+SpriteBatch::TextureBucket& SpriteBatch::GetTextureBucket(const GLuint textureID)
+{
+	if (m_lastBucketIndex < m_textureBuckets.size() && m_textureBuckets[m_lastBucketIndex].textureID == textureID)
+	{
+		return m_textureBuckets[m_lastBucketIndex];
+	}
+
+	for (m_lastBucketIndex = 0; m_lastBucketIndex < m_textureBuckets.size(); ++m_lastBucketIndex)
+	{
+		if (m_textureBuckets[m_lastBucketIndex].textureID == textureID)
+		{
+			return m_textureBuckets[m_lastBucketIndex];
+		}
+	}
+
+	m_textureBuckets.push_back(TextureBucket{ textureID, { } });
+
+	return m_textureBuckets.back();
+}
+
+void SpriteBatch::DrawTextureBucket(const TextureBucket& bucket)
+{
+	RenderState::BindTexture(GL_TEXTURE_2D, bucket.textureID);
+
+	size_t drawnSpriteCount = 0;
+
+	while (drawnSpriteCount < bucket.sprites.size())
+	{
+		if (m_regionSpriteCount == m_spritesPerRegion)
+		{
+			AdvanceRegion();
+			WaitForRegion(m_regionIndex);
+		}
+
+		const size_t spriteCount = std::min(bucket.sprites.size() - drawnSpriteCount, m_spritesPerRegion - m_regionSpriteCount);
+		const size_t firstSpriteIndex = m_regionIndex * m_spritesPerRegion + m_regionSpriteCount;
+
+		std::copy_n(std::cbegin(bucket.sprites) + static_cast<std::ptrdiff_t>(drawnSpriteCount), spriteCount, reinterpret_cast<SpriteVertices*>(m_mappedVertices) + firstSpriteIndex);
+		glDrawElementsBaseVertex(GL_TRIANGLES, static_cast<GLsizei>(QuadElementBuffer::GetElementCount(spriteCount)), QuadElementBuffer::GetElementType(), nullptr, static_cast<GLint>(firstSpriteIndex * s_VerticesPerSprite));
+		++m_statistics.drawCallCount;
+
+		m_regionSpriteCount += spriteCount;
+		drawnSpriteCount += spriteCount;
+	}
+}
+
+void SpriteBatch::WaitForRegion(const size_t regionIndex)
+{
+	GLsync& fence = m_regionFences[regionIndex];
+
+	if (fence == nullptr)
+	{
+		return;
+	}
+
+	constexpr GLuint64 WaitTimeout = 1'000'000u;
+	GLenum waitResult = glClientWaitSync(fence, 0, 0);
+
+	if (waitResult == GL_TIMEOUT_EXPIRED)
+	{
+		++m_statistics.regionWaitCount;
+
+		do
+		{
+			waitResult = glClientWaitSync(fence, GL_SYNC_FLUSH_COMMANDS_BIT, WaitTimeout);
+		}
+		while (waitResult == GL_TIMEOUT_EXPIRED);
+	}
+
+	glDeleteSync(fence);
+	fence = nullptr;
+}
+
+void SpriteBatch::FenceRegion(const size_t regionIndex)
+{
+	m_regionFences[regionIndex] = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+}
+
+void SpriteBatch::AdvanceRegion()
+{
+	FenceRegion(m_regionIndex);
+
+	m_regionIndex = (m_regionIndex + 1) % s_RegionCount;
+	m_regionSpriteCount = 0;
+}
\ No newline at end of file
@@ -0,0 +1,99 @@
+#pragma once
+#ifndef SPRITE_BATCH_H
+#define SPRITE_BATCH_H
+
+#include "../interfaces/INoncopyable.h"
+#include "../interfaces/INonmovable.h"
+
+#include <glad/glad.h>
+#include <glm/glm.hpp>
+
+#include <array>
+#include <cstddef>
+#include <vector>
+
+#include "QuadElementBuffer.h"
+#include "shaders/ShaderProgram.h"
+#include "Texture.h"
+
+class SpriteBatch
+	: private INoncopyable, private INonmovable
+{
+public:
+	struct Statistics
+	{
+		size_t spriteCount = 0;
+		size_t drawCallCount = 0;
+		size_t regionWaitCount = 0;
+	};
+
+private:
+	struct SpriteVertex
+	{
+		glm::vec2 position;
+		glm::vec2 textureCoordinates;
+		glm::vec4 colour;
+	};
+
+	using SpriteVertices = std::array<SpriteVertex, 4u>;
+
+	struct TextureBucket
+	{
+		GLuint textureID = 0;
+		std::vector<SpriteVertices> sprites;
+	};
+
+	enum VertexAttributes
+		: GLuint
+	{
+		Position,
+		TextureCoordinates,
+		Colour
+	};
+
+	static constexpr size_t s_RegionCount = 3u;
+	static constexpr size_t s_VerticesPerSprite = 4u;
+
+	const ShaderProgram* m_shader = nullptr;
+
+	size_t m_spritesPerRegion = 0;
+	QuadElementBuffer m_quadElementBuffer;
+
+	GLuint m_vao = 0;
+	GLuint m_vbo = 0;
+	SpriteVertex* m_mappedVertices = nullptr;
+
+	std::array<GLsync, s_RegionCount> m_regionFences{ };
+	size_t m_regionIndex = 0;
+
+	std::vector<TextureBucket> m_textureBuckets;
+	size_t m_lastBucketIndex = 0;
+	size_t m_regionSpriteCount = 0;
+	bool m_isDrawing = false;
+	bool m_wasDepthTestEnabled = true;
+
+	Statistics m_statistics;
+	Statistics m_lastStatistics;
+
+public:
+	SpriteBatch(const ShaderProgram& shader, const size_t spritesPerRegion);
+	~SpriteBatch() noexcept;
+
+	void Begin();
+	void Draw(const Texture& texture, const glm::vec2& position, const glm::vec2& size, const float rotation = 0.0f, const glm::vec4& colour = glm::vec4{ 1.0f }, const glm::vec2& textureMin = glm::vec2{ 0.0f, 0.0f }, const glm::vec2& textureMax = glm::vec2{ 1.0f, 1.0f });
+	void End();
+
+	inline const Statistics& GetStatistics() const noexcept { return m_lastStatistics; }
+
+private:
+	void InitialiseVertexObjects();
+
+	TextureBucket& GetTextureBucket(const GLuint textureID);
+	void DrawTextureBucket(const TextureBucket& bucket);
+
+	void WaitForRegion(const size_t regionIndex);
+	void FenceRegion(const size_t regionIndex);
+	void AdvanceRegion();
+};
+
+#endif
\ No newline at end of file
@@ -7,6 +7,7 @@
 #include <utility>
 
 #include "../error/GameException.h"
+#include "RenderState.h"
 
 Texture::Texture(const std::string& filepath)
 {
@@ -51,7 +52,7 @@ Texture::~Texture() noexcept
 
 void Texture::Bind() const
 {
-	glBindTexture(GL_TEXTURE_2D, m_id);
+	RenderState::BindTexture(GL_TEXTURE_2D, m_id);
 }
 
 void Texture::Generate(const std::string& filepath)
@@ -101,11 +102,12 @@ void Texture::SetupParameters(const GLint internalFormat, const GLenum format, c
 	glGetFloatv(GL_MAX_TEXTURE_MAX_ANISOTROPY, &maxAnisotropy);
 	glTexParameterf(GL_TEXTURE_2D, GL_TEXTURE_MAX_ANISOTROPY, maxAnisotropy);
 	
-	glBindTexture(GL_TEXTURE_2D, 0);
+	RenderState::BindTexture(GL_TEXTURE_2D, 0);
 }
 
 void Texture::Destroy() noexcept
 {
+	RenderState::OnTextureDeleted(m_id);
 	glDeleteTextures(1, &m_id);
 	m_id = 0;
 }
@@ -7,6 +7,7 @@
 #include <utility>
 
 #include "../error/GameException.h"
+#include "RenderState.h"
 
 TextureArray::TextureArray(const std::string& filepath, const glm::uvec2& subTextureSize)
 	: m_subTextureSize(subTextureSize)
@@ -43,7 +44,7 @@ TextureArray::~TextureArray() noexcept
 
 void TextureArray::Bind() const
 {
-	glBindTexture(GL_TEXTURE_2D_ARRAY, m_id);
+	RenderState::BindTexture(GL_TEXTURE_2D_ARRAY, m_id);
 }
 
 void TextureArray::Generate(const std::string& filepath)
@@ -91,8 +92,8 @@ void TextureArray::SetupParameters(const GLint internalFormat, const GLenum form
 	glGenerateMipmap(GL_TEXTURE_2D_ARRAY);
 
 	const std::initializer_list<std::pair<GLenum, GLint>> textureParameters{
-		{ GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE },
-		{ GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE },
+		{ GL_TEXTURE_WRAP_S, GL_REPEAT },
+		{ GL_TEXTURE_WRAP_T, GL_REPEAT },
 		{ GL_TEXTURE_MIN_FILTER, GL_NEAREST_MIPMAP_LINEAR },
 		{ GL_TEXTURE_MAG_FILTER, GL_NEAREST }
 	};
@@ -106,12 +107,13 @@ void TextureArray::SetupParameters(const GLint internalFormat, const GLenum form
 	glGetFloatv(GL_MAX_TEXTURE_MAX_ANISOTROPY, &maxAnisotropy);
 	glTexParameterf(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_MAX_ANISOTROPY, maxAnisotropy);
 
-	glBindTexture(GL_TEXTURE_2D_ARRAY, 0);
+	RenderState::BindTexture(GL_TEXTURE_2D_ARRAY, 0);
 	glPixelStorei(GL_UNPACK_ROW_LENGTH, 0);
 }
 
 void TextureArray::Destroy() noexcept
 {
+	RenderState::OnTextureDeleted(m_id);
 	glDeleteTextures(1, &m_id);
 	m_id = 0;
 }
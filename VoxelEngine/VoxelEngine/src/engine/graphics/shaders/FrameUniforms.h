@@ -0,0 +1,24 @@
+#pragma once
+#ifndef FRAME_UNIFORMS_H
+#define FRAME_UNIFORMS_H
+
+#include <glad/glad.h>
+#include <glm/glm.hpp>
+
+#include <cstddef>
+
+struct FrameUniforms
+{
+	static constexpr GLuint s_BindingPoint = 0u;
+
+	glm::mat4 view{ 1.0f };
+	glm::mat4 projection{ 1.0f };
+	glm::mat4 viewProjection{ 1.0f };
+	glm::mat4 orthographicProjection{ 1.0f };
+	glm::vec3 cameraPosition{ 0.0f, 0.0f, 0.0f };
+	float time = 0.0f;
+};
+
+static_assert(offsetof(FrameUniforms, orthographicProjection) == 192u && offsetof(FrameUniforms, cameraPosition) == 256u && offsetof(FrameUniforms, time) == 268u && sizeof(FrameUniforms) == 272u, "FrameUniforms does not match the std140 layout of the shader uniform block.");
+
+#endif
\ No newline at end of file
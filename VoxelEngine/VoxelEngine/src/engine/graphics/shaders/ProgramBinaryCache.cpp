@@ -0,0 +1,166 @@
+#include "ProgramBinaryCache.h"
+
+#include <filesystem>
+#include <fstream>
+#include <iomanip>
+#include <sstream>
+#include <vector>
+
+#include "../../utility/Logger.h"
+
+std::uint64_t ProgramBinaryCache::HashSource(const std::string& source, const std::uint64_t previousHash) noexcept
+{
+	std::uint64_t hash = previousHash;
+
+	for (const char character : source)
+	{
+		hash ^= static_cast<std::uint8_t>(character);
+		hash *= s_HashPrime;
+	}
+
+	return hash;
+}
+
+ProgramBinaryCache::ProgramBinaryCache(const std::string& directory)
+	: m_directory(directory)
+{
+	GLint binaryFormatCount = 0;
+	glGetIntegerv(GL_NUM_PROGRAM_BINARY_FORMATS, &binaryFormatCount);
+	m_isSupported = binaryFormatCount > 0;
+
+	for (const GLenum driverString : { GL_VENDOR, GL_RENDERER, GL_VERSION })
+	{
+		if (const GLubyte* driverStringData = glGetString(driverString);
+			driverStringData != nullptr)
+		{
+			m_driverKey += reinterpret_cast<const char*>(driverStringData);
+		}
+
+		m_driverKey += '\n';
+	}
+
+	if (m_isSupported)
+	{
+		std::error_code errorCode;
+		std::filesystem::create_directories(m_directory, errorCode);
+
+		if (errorCode)
+		{
+			Logger::Log("Could not create program binary cache directory " + m_directory + ": " + errorCode.message());
+			m_isSupported = false;
+		}
+	}
+}
+
+bool ProgramBinaryCache::Load(const GLuint program, const std::uint64_t sourceHash) const
+{
+	if (!m_isSupported)
+	{
+		++m_statistics.missCount;
+
+		return false;
+	}
+
+	std::ifstream cacheFile(GetFilepath(sourceHash), std::ios_base::in | std::ios_base::binary);
+
+	std::uint32_t signature = 0;
+	std::uint64_t cachedSourceHash = 0;
+	std::uint32_t driverKeyLength = 0;
+	GLenum binaryFormat = 0;
+	std::uint32_t binaryLength = 0;
+
+	cacheFile.read(reinterpret_cast<char*>(&signature), sizeof(signature));
+	cacheFile.read(reinterpret_cast<char*>(&cachedSourceHash), sizeof(cachedSourceHash));
+	cacheFile.read(reinterpret_cast<char*>(&driverKeyLength), sizeof(driverKeyLength));
+
+	if (!cacheFile || signature != s_FileSignature || cachedSourceHash != sourceHash || driverKeyLength != m_driverKey.length())
+	{
+		++m_statistics.missCount;
+
+		return false;
+	}
+
+	std::string cachedDriverKey(driverKeyLength, '\0');
+	cacheFile.read(cachedDriverKey.data(), driverKeyLength);
+	cacheFile.read(reinterpret_cast<char*>(&binaryFormat), sizeof(binaryFormat));
+	cacheFile.read(reinterpret_cast<char*>(&binaryLength), sizeof(binaryLength));
+
+	if (!cacheFile || cachedDriverKey != m_driverKey)
+	{
+		++m_statistics.missCount;
+
+		return false;
+	}
+
+	std::vector<char> binary(binaryLength);
+	cacheFile.read(binary.data(), binaryLength);
+
+	if (!cacheFile)
+	{
+		++m_statistics.missCount;
+
+		return false;
+	}
+
+	glProgramBinary(program, binaryFormat, binary.data(), static_cast<GLsizei>(binaryLength));
+
+	GLint isLinked = GL_FALSE;
+	glGetProgramiv(program, GL_LINK_STATUS, &isLinked);
+
+	if (isLinked != GL_TRUE)
+	{
+		Logger::Log("Program binary " + GetFilepath(sourceHash) + " was rejected by the driver; recompiling.");
+		++m_statistics.missCount;
+
+		return false;
+	}
+
+	++m_statistics.hitCount;
+
+	return true;
+}
+
+void ProgramBinaryCache::Save(const GLuint program, const std::uint64_t sourceHash) const
+{
+	if (!m_isSupported)
+	{
+		return;
+	}
+
+	GLint binaryLength = 0;
+	glGetProgramiv(program, GL_PROGRAM_BINARY_LENGTH, &binaryLength);
+
+	if (binaryLength <= 0)
+	{
+		return;
+	}
+
+	std::vector<char> binary(static_cast<size_t>(binaryLength));
+	GLenum binaryFormat = 0;
+	glGetProgramBinary(program, binaryLength, &binaryLength, &binaryFormat, binary.data());
+
+	const std::uint32_t driverKeyLength = static_cast<std::uint32_t>(m_driverKey.length());
+	const std::uint32_t writtenBinaryLength = static_cast<std::uint32_t>(binaryLength);
+
+	std::ofstream cacheFile(GetFilepath(sourceHash), std::ios_base::out | std::ios_base::binary | std::ios_base::trunc);
+	cacheFile.write(reinterpret_cast<const char*>(&s_FileSignature), sizeof(s_FileSignature));
+	cacheFile.write(reinterpret_cast<const char*>(&sourceHash), sizeof(sourceHash));
+	cacheFile.write(reinterpret_cast<const char*>(&driverKeyLength), sizeof(driverKeyLength));
+	cacheFile.write(m_driverKey.data(), driverKeyLength);
+	cacheFile.write(reinterpret_cast<const char*>(&binaryFormat), sizeof(binaryFormat));
+	cacheFile.write(reinterpret_cast<const char*>(&writtenBinaryLength), sizeof(writtenBinaryLength));
+	cacheFile.write(binary.data(), writtenBinaryLength);
+
+	if (!cacheFile)
+	{
+		Logger::Log("Could not write program binary " + GetFilepath(sourceHash) + ".");
+	}
+}
+
+std::string ProgramBinaryCache::GetFilepath(const std::uint64_t sourceHash) const
+{
+	std::ostringstream filepathStream;
+	filepathStream << m_directory << "/" << std::hex << std::setw(16) << std::setfill('0') << HashSource(m_driverKey, sourceHash) << ".bin";
+
+	return filepathStream.str();
+}
\ No newline at end of file
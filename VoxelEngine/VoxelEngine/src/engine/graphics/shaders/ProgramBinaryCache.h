@@ -0,0 +1,50 @@
+#pragma once
+#ifndef PROGRAM_BINARY_CACHE_H
+#define PROGRAM_BINARY_CACHE_H
+
+#include "../../interfaces/INoncopyable.h"
+#include "../../interfaces/INonmovable.h"
+
+#include <glad/glad.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+class ProgramBinaryCache
+	: private INoncopyable, private INonmovable
+{
+public:
+	struct Statistics
+	{
+		size_t hitCount = 0;
+		size_t missCount = 0;
+	};
+
+private:
+	static constexpr std::uint32_t s_FileSignature = 0x42505645u;
+	static constexpr std::uint64_t s_HashOffsetBasis = 0xCBF29CE484222325ull;
+	static constexpr std::uint64_t s_HashPrime = 0x100000001B3ull;
+
+	std::string m_directory;
+	std::string m_driverKey;
+	bool m_isSupported = false;
+
+	mutable Statistics m_statistics;
+
+public:
+	static std::uint64_t HashSource(const std::string& source, const std::uint64_t previousHash = s_HashOffsetBasis) noexcept;
+
+	explicit ProgramBinaryCache(const std::string& directory);
+	~ProgramBinaryCache() noexcept = default;
+
+	bool Load(const GLuint program, const std::uint64_t sourceHash) const;
+	void Save(const GLuint program, const std::uint64_t sourceHash) const;
+
+	inline const Statistics& GetStatistics() const noexcept { return m_statistics; }
+
+private:
+	std::string GetFilepath(const std::uint64_t sourceHash) const;
+};
+
+#endif
\ No newline at end of file
@@ -27,6 +27,8 @@ private:
 	GLuint m_id = 0;
 
 public:
+	static std::string ReadShaderFile(const std::string& filepath, const bool isSpirV);
+
 	Shader(const Type type, const std::string& filepath, const bool isSpirV = false);
 
 	Shader(Shader&& other) noexcept;
@@ -37,8 +39,6 @@ public:
 	inline GLuint GetID() const noexcept { return m_id; }
 
 private:
-	std::string ReadShaderFile(const std::string& filepath, const bool isSpirV);
-
 	void CompileShader(const char* shaderCodeData);
 	void CompileSpirVShader(const std::string& shaderCode);
 
@@ -7,39 +7,54 @@
 
 #include "../../utility/Logger.h"
 #include "../../error/GameException.h"
+#include "../RenderState.h"
 
 ShaderProgram::ShaderProgram(const std::initializer_list<Shader>& shaders)
 	: m_id(glCreateProgram())
 {
+	std::vector<GLuint> shaderIDs;
+	shaderIDs.reserve(shaders.size());
+
 	for (const auto& shader : shaders)
 	{
-		glAttachShader(m_id, shader.GetID());
+		shaderIDs.push_back(shader.GetID());
 	}
 
-	glLinkProgram(m_id);
+	Link(shaderIDs);
+}
 
-	if (!CheckLinkingStatus())
-	{
-		std::ostringstream errorMessageStream;
-		errorMessageStream << "Failed to link program " << m_id << ".";
+ShaderProgram::ShaderProgram(const std::initializer_list<ShaderFile>& shaderFiles, const ProgramBinaryCache& binaryCache)
+	: m_id(glCreateProgram())
+{
+	std::string sources;
 
-		throw GameException(GameException::Shader::Link, errorMessageStream.str());
+	for (const auto& shaderFile : shaderFiles)
+	{
+		sources += std::to_string(static_cast<GLenum>(shaderFile.type)) + "\n";
+		sources += Shader::ReadShaderFile(shaderFile.filepath, false);
 	}
 
-	glValidateProgram(m_id);
+	const std::uint64_t sourceHash = ProgramBinaryCache::HashSource(sources);
 
-	if (!CheckValidationStatus())
+	if (binaryCache.Load(m_id, sourceHash))
 	{
-		std::ostringstream errorMessageStream;
-		errorMessageStream << "Failed to validate program " << m_id << ".";
-
-		throw GameException(GameException::Shader::Validate, errorMessageStream.str());
+		return;
 	}
 
-	for (const auto& shader : shaders)
+	std::vector<Shader> shaders;
+	std::vector<GLuint> shaderIDs;
+	shaders.reserve(shaderFiles.size());
+	shaderIDs.reserve(shaderFiles.size());
+
+	for (const auto& shaderFile : shaderFiles)
 	{
-		glDetachShader(m_id, shader.GetID());
+		shaderIDs.push_back(shaders.emplace_back(shaderFile.type, shaderFile.filepath).GetID());
 	}
+
+	glProgramParameteri(m_id, GL_PROGRAM_BINARY_RETRIEVABLE_HINT, GL_TRUE);
+	Link(shaderIDs);
+
+	binaryCache.Save(m_id, sourceHash);
 }
 
 ShaderProgram::ShaderProgram(ShaderProgram&& other) noexcept
@@ -71,7 +86,7 @@ ShaderProgram::~ShaderProgram() noexcept
 
 void ShaderProgram::Use() const
 {
-	glUseProgram(m_id);
+	RenderState::UseProgram(m_id);
 }
 
 void ShaderProgram::SetTextureUniform(const std::string& name, const int index) const
@@ -80,6 +95,44 @@ void ShaderProgram::SetTextureUniform(const std::string& name, const int index)
 	glUniform1i(location, index);
 }
 
+ShaderProgram::UniformHandle ShaderProgram::GetUniformHandle(const std::string& name) const
+{
+	return UniformHandle{ GetUniformLocation(name) };
+}
+
+void ShaderProgram::Link(const std::vector<GLuint>& shaderIDs)
+{
+	for (const GLuint shaderID : shaderIDs)
+	{
+		glAttachShader(m_id, shaderID);
+	}
+
+	glLinkProgram(m_id);
+
+	if (!CheckLinkingStatus())
+	{
+		std::ostringstream errorMessageStream;
+		errorMessageStream << "Failed to link program " << m_id << ".";
+
+		throw GameException(GameException::Shader::Link, errorMessageStream.str());
+	}
+
+	glValidateProgram(m_id);
+
+	if (!CheckValidationStatus())
+	{
+		std::ostringstream errorMessageStream;
+		errorMessageStream << "Failed to validate program " << m_id << ".";
+
+		throw GameException(GameException::Shader::Validate, errorMessageStream.str());
+	}
+
+	for (const GLuint shaderID : shaderIDs)
+	{
+		glDetachShader(m_id, shaderID);
+	}
+}
+
 bool ShaderProgram::CheckLinkingStatus() const
 {
 	if (!CheckStatus(GL_LINK_STATUS))
@@ -132,6 +185,7 @@ bool ShaderProgram::CheckStatus(const GLenum status) const
 
 void ShaderProgram::Destroy() noexcept
 {
+	RenderState::OnProgramDeleted(m_id);
 	glDeleteProgram(m_id);
 	m_id = 0;
 }
@@ -148,9 +202,10 @@ GLuint ShaderProgram::ResetProgram(const GLuint newProgramID) noexcept
 
 int ShaderProgram::GetUniformLocation(const std::string& uniformName) const
 {
-	if (m_uniformCache.find(uniformName) != std::cend(m_uniformCache))
+	if (const auto uniformLocation = m_uniformCache.find(uniformName);
+		uniformLocation != std::cend(m_uniformCache))
 	{
-		return m_uniformCache[uniformName];
+		return uniformLocation->second;
 	}
 
 	const int location = glGetUniformLocation(m_id, uniformName.c_str());
@@ -13,12 +13,26 @@
 #include <memory>
 #include <unordered_map>
 #include <string>
+#include <vector>
 
+#include "ProgramBinaryCache.h"
 #include "Shader.h"
 
 class ShaderProgram
 	: private INoncopyable
 {
+public:
+	struct UniformHandle
+	{
+		GLint location = -1;
+	};
+
+	struct ShaderFile
+	{
+		Shader::Type type;
+		std::string filepath;
+	};
+
 private:
 	GLuint m_id = 0;
 
@@ -26,6 +40,7 @@ private:
 
 public:
 	ShaderProgram(const std::initializer_list<Shader>& shaders);
+	ShaderProgram(const std::initializer_list<ShaderFile>& shaderFiles, const ProgramBinaryCache& binaryCache);
 
 	ShaderProgram(ShaderProgram&& other) noexcept;
 	ShaderProgram& operator =(ShaderProgram&& other) noexcept;
@@ -35,92 +50,98 @@ public:
 	void Use() const;
 
 	template <typename T>
-	void SetUniform(const std::string& name, const T& value) const
+	inline void SetUniform(const std::string& name, const T& value) const
+	{
+		SetUniform<T>(GetUniformHandle(name), value);
+	}
+
+	template <typename T>
+	inline void SetUniformVector(const std::string& name, const T* values, const size_t count) const
+	{
+		SetUniformVector<T>(GetUniformHandle(name), values, count);
+	}
+
+	template <typename T>
+	void SetUniform(const UniformHandle uniform, const T& value) const
 	{
 		static_assert(false, "Invalid uniform type.");
 	}
 
 	template <>
-	void SetUniform<bool>(const std::string& name, const bool& value) const
+	void SetUniform<bool>(const UniformHandle uniform, const bool& value) const
 	{
-		const GLint location = GetUniformLocation(name);
-		glUniform1i(location, static_cast<int>(value));
+		glUniform1i(uniform.location, static_cast<int>(value));
 	}
 
 	template <>
-	void SetUniform<int>(const std::string& name, const int& value) const
+	void SetUniform<int>(const UniformHandle uniform, const int& value) const
 	{
-		const GLint location = GetUniformLocation(name);
-		glUniform1i(location, value);
+		glUniform1i(uniform.location, value);
 	}
 
 	template <>
-	void SetUniform<float>(const std::string& name, const float& value) const
+	void SetUniform<float>(const UniformHandle uniform, const float& value) const
 	{
-		const GLint location = GetUniformLocation(name);
-		glUniform1f(location, value);
+		glUniform1f(uniform.location, value);
 	}
 
 	template <>
-	void SetUniform<double>(const std::string& name, const double& value) const
+	void SetUniform<double>(const UniformHandle uniform, const double& value) const
 	{
-		const GLint location = GetUniformLocation(name);
-		glUniform1f(location, static_cast<float>(value));
+		glUniform1f(uniform.location, static_cast<float>(value));
 	}
 
 	template <>
-	void SetUniform<glm::vec2>(const std::string& name, const glm::vec2& value) const
+	void SetUniform<glm::vec2>(const UniformHandle uniform, const glm::vec2& value) const
 	{
-		const GLint location = GetUniformLocation(name);
-		glUniform2fv(location, 1, glm::value_ptr(value));
+		glUniform2fv(uniform.location, 1, glm::value_ptr(value));
 	}
 
 	template <>
-	void SetUniform<glm::vec3>(const std::string& name, const glm::vec3& value) const
+	void SetUniform<glm::vec3>(const UniformHandle uniform, const glm::vec3& value) const
 	{
-		const GLint location = GetUniformLocation(name);
-		glUniform3fv(location, 1, glm::value_ptr(value));
+		glUniform3fv(uniform.location, 1, glm::value_ptr(value));
 	}
 
 	template <>
-	void SetUniform<glm::vec4>(const std::string& name, const glm::vec4& value) const
+	void SetUniform<glm::vec4>(const UniformHandle uniform, const glm::vec4& value) const
 	{
-		const GLint location = GetUniformLocation(name);
-		glUniform4fv(location, 1, glm::value_ptr(value));
+		glUniform4fv(uniform.location, 1, glm::value_ptr(value));
 	}
 
 	template <>
-	void SetUniform<glm::mat4>(const std::string& name, const glm::mat4& value) const
+	void SetUniform<glm::mat4>(const UniformHandle uniform, const glm::mat4& value) const
 	{
-		const GLint location = GetUniformLocation(name);
-		glUniformMatrix4fv(location, 1, GL_FALSE, glm::value_ptr(value));
+		glUniformMatrix4fv(uniform.location, 1, GL_FALSE, glm::value_ptr(value));
 	}
 
 	template <typename T>
-	void SetUniformVector(const std::string& name, const T* values, const size_t count) const
+	void SetUniformVector(const UniformHandle uniform, const T* values, const size_t count) const
 	{
 		static_assert(false, "Invalid uniform type.");
 	}
 
 	template <>
-	void SetUniformVector<float>(const std::string& name, const float* values, const size_t count) const
+	void SetUniformVector<float>(const UniformHandle uniform, const float* values, const size_t count) const
 	{
-		const GLint location = GetUniformLocation(name);
-		glUniform1fv(location, static_cast<GLsizei>(count), values);
+		glUniform1fv(uniform.location, static_cast<GLsizei>(count), values);
 	}
 
 	template <>
-	void SetUniformVector<glm::vec2>(const std::string& name, const glm::vec2* values, const size_t count) const
+	void SetUniformVector<glm::vec2>(const UniformHandle uniform, const glm::vec2* values, const size_t count) const
 	{
-		const GLint location = GetUniformLocation(name);
-		glUniform2fv(location, static_cast<GLsizei>(count), reinterpret_cast<const float*>(values));
+		glUniform2fv(uniform.location, static_cast<GLsizei>(count), reinterpret_cast<const float*>(values));
 	}
 
 	void SetTextureUniform(const std::string& name, const int index) const;
 
+	UniformHandle GetUniformHandle(const std::string& name) const;
+
 	inline GLuint GetID() const noexcept { return m_id; }
 
 private:
+	void Link(const std::vector<GLuint>& shaderIDs);
+
 	bool CheckLinkingStatus() const;
 	bool CheckValidationStatus() const;
 	bool CheckStatus(const GLenum status) const;
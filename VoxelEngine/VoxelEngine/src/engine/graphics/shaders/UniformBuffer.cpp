@@ -0,0 +1,30 @@
+#include "UniformBuffer.h"
+
+#include <algorithm>
+
+UniformBuffer::UniformBuffer(const GLuint bindingPoint, const size_t size)
+	: m_bindingPoint(bindingPoint), m_size(size)
+{
+	glGenBuffers(1, &m_id);
+	glBindBuffer(GL_UNIFORM_BUFFER, m_id);
+	glBufferStorage(GL_UNIFORM_BUFFER, static_cast<GLsizeiptr>(m_size), nullptr, GL_DYNAMIC_STORAGE_BIT);
+	glBindBuffer(GL_UNIFORM_BUFFER, 0);
+
+	glBindBufferBase(GL_UNIFORM_BUFFER, m_bindingPoint, m_id);
+}
+
+UniformBuffer::~UniformBuffer() noexcept
+{
+	if (m_id != 0)
+	{
+		glDeleteBuffers(1, &m_id);
+		m_id = 0;
+	}
+}
+
+void UniformBuffer::SetData(const void* data, const size_t size) const
+{
+	glBindBuffer(GL_UNIFORM_BUFFER, m_id);
+	glBufferSubData(GL_UNIFORM_BUFFER, 0, static_cast<GLsizeiptr>(std::min(size, m_size)), data);
+	glBindBuffer(GL_UNIFORM_BUFFER, 0);
+}
\ No newline at end of file
@@ -0,0 +1,37 @@
+#pragma once
+#ifndef UNIFORM_BUFFER_H
+#define UNIFORM_BUFFER_H
+
+#include "../../interfaces/INoncopyable.h"
+#include "../../interfaces/INonmovable.h"
+
+#include <glad/glad.h>
+
+#include <cstddef>
+
+class UniformBuffer
+	: private INoncopyable, private INonmovable
+{
+private:
+	GLuint m_id = 0;
+	GLuint m_bindingPoint = 0;
+	size_t m_size = 0;
+
+public:
+	UniformBuffer(const GLuint bindingPoint, const size_t size);
+	~UniformBuffer() noexcept;
+
+	void SetData(const void* data, const size_t size) const;
+
+	template <typename T>
+	inline void SetData(const T& data) const
+	{
+		SetData(&data, sizeof(T));
+	}
+
+	inline GLuint GetID() const noexcept { return m_id; }
+	inline GLuint GetBindingPoint() const noexcept { return m_bindingPoint; }
+	inline size_t GetSize() const noexcept { return m_size; }
+};
+
+#endif
\ No newline at end of file
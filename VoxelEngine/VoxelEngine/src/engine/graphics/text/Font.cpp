@@ -1,16 +1,17 @@
 #include "Font.h"
 
+#include <algorithm>
 #include <initializer_list>
+#include <iterator>
 #include <sstream>
 #include <utility>
 
 #include "../../error/GameException.h"
 #include "../../utility/Logger.h"
+#include "../RenderState.h"
 
 Font::Font(const std::string& fontFilepath, const unsigned int fontSize)
 {
-	m_glyphs.clear();
-	
 	FT_Library ftLibrary = nullptr;
 
 	if (FT_Init_FreeType(&ftLibrary) != 0)
@@ -32,11 +33,10 @@ Font::Font(const std::string& fontFilepath, const unsigned int fontSize)
 	}
 
 	FT_Set_Pixel_Sizes(face, 0, fontSize);
-	glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
 
-	constexpr unsigned char MaxASCIICount = 128u;
+	std::array<GlyphBitmap, s_GlyphCount> bitmaps;
 
-	for (unsigned char c = 0; c < MaxASCIICount; ++c)
+	for (unsigned char c = 0; c < s_GlyphCount; ++c)
 	{
 		if (FT_Load_Char(face, c, FT_LOAD_RENDER) != 0)
 		{
@@ -48,36 +48,97 @@ Font::Font(const std::string& fontFilepath, const unsigned int fontSize)
 			continue;
 		}
 
-		m_glyphs.insert({ c, CreateGlyph(face) });
-	}
+		const FT_Bitmap& bitmap = face->glyph->bitmap;
 
-	glBindTexture(GL_TEXTURE_2D, 0);
-	glPixelStorei(GL_UNPACK_ALIGNMENT, 4);
+		m_glyphs[c].size = glm::ivec2{ bitmap.width, bitmap.rows };
+		m_glyphs[c].bearing = glm::ivec2{ face->glyph->bitmap_left, face->glyph->bitmap_top };
+		m_glyphs[c].advance = static_cast<unsigned int>(face->glyph->advance.x);
+
+		bitmaps[c].size = glm::uvec2{ bitmap.width, bitmap.rows };
+		bitmaps[c].pixels.resize(static_cast<size_t>(bitmap.width) * bitmap.rows);
+
+		for (unsigned int row = 0; row < bitmap.rows; ++row)
+		{
+			std::copy_n(bitmap.buffer + static_cast<std::ptrdiff_t>(row) * bitmap.pitch, bitmap.width, std::begin(bitmaps[c].pixels) + static_cast<std::ptrdiff_t>(row) * bitmap.width);
+		}
+	}
 
 	FT_Done_Face(face);
 	FT_Done_FreeType(ftLibrary);
+
+	CreateAtlas(bitmaps);
 }
 
 Font::Font(Font&& other) noexcept
-	: m_glyphs(std::move(other.m_glyphs))
-{
-	other.m_glyphs.clear();
-}
+	: m_atlasID(std::exchange(other.m_atlasID, 0)), m_atlasSize(std::exchange(other.m_atlasSize, glm::uvec2{ 0u, 0u })), m_glyphs(other.m_glyphs)
+{ }
 
 Font& Font::operator=(Font&& other) noexcept
 {
-	m_glyphs = std::move(other.m_glyphs);
-	other.m_glyphs.clear();
+	Destroy();
+
+	m_atlasID = std::exchange(other.m_atlasID, 0);
+	m_atlasSize = std::exchange(other.m_atlasSize, glm::uvec2{ 0u, 0u });
+	m_glyphs = other.m_glyphs;
 
 	return *this;
 }
 
-Font::Glyph Font::CreateGlyph(const FT_Face& face) const
+Font::~Font() noexcept
 {
-	GLuint textureID = 0;
-	glGenTextures(1, &textureID);
-	glBindTexture(GL_TEXTURE_2D, textureID);
-	glTexImage2D(GL_TEXTURE_2D, 0, GL_R8, face->glyph->bitmap.width, face->glyph->bitmap.rows, 0, GL_RED, GL_UNSIGNED_BYTE, face->glyph->bitmap.buffer);
+	Destroy();
+}
+
+void Font::Bind() const
+{
+	RenderState::BindTexture(GL_TEXTURE_2D, m_atlasID);
+}
+
+void Font::CreateAtlas(const std::array<GlyphBitmap, s_GlyphCount>& bitmaps)
+{
+	std::array<glm::uvec2, s_GlyphCount> glyphOffsets{ };
+	glm::uvec2 cursor{ s_AtlasPadding, s_AtlasPadding };
+	unsigned int rowHeight = 0;
+
+	for (size_t i = 0; i < s_GlyphCount; ++i)
+	{
+		if (cursor.x + bitmaps[i].size.x + s_AtlasPadding > s_AtlasWidth)
+		{
+			cursor = glm::uvec2{ s_AtlasPadding, cursor.y + rowHeight + s_AtlasPadding };
+			rowHeight = 0;
+		}
+
+		glyphOffsets[i] = cursor;
+		cursor.x += bitmaps[i].size.x + s_AtlasPadding;
+		rowHeight = std::max(rowHeight, bitmaps[i].size.y);
+	}
+
+	m_atlasSize = glm::uvec2{ s_AtlasWidth, 1u };
+
+	while (m_atlasSize.y < cursor.y + rowHeight + s_AtlasPadding)
+	{
+		m_atlasSize.y *= 2u;
+	}
+
+	std::vector<unsigned char> atlasPixels(static_cast<size_t>(m_atlasSize.x) * m_atlasSize.y, 0u);
+
+	for (size_t i = 0; i < s_GlyphCount; ++i)
+	{
+		for (unsigned int row = 0; row < bitmaps[i].size.y; ++row)
+		{
+			std::copy_n(std::begin(bitmaps[i].pixels) + static_cast<std::ptrdiff_t>(row) * bitmaps[i].size.x, bitmaps[i].size.x, std::begin(atlasPixels) + static_cast<std::ptrdiff_t>(glyphOffsets[i].y + row) * m_atlasSize.x + glyphOffsets[i].x);
+		}
+
+		m_glyphs[i].textureMin = glm::vec2(glyphOffsets[i]) / glm::vec2(m_atlasSize);
+		m_glyphs[i].textureMax = glm::vec2(glyphOffsets[i] + bitmaps[i].size) / glm::vec2(m_atlasSize);
+	}
+
+	glGenTextures(1, &m_atlasID);
+	Bind();
+
+	glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+	glTexImage2D(GL_TEXTURE_2D, 0, GL_R8, m_atlasSize.x, m_atlasSize.y, 0, GL_RED, GL_UNSIGNED_BYTE, atlasPixels.data());
+	glPixelStorei(GL_UNPACK_ALIGNMENT, 4);
 
 	const std::initializer_list<std::pair<GLenum, GLint>> textureParameters{
 		{ GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE },
@@ -91,12 +152,15 @@ Font::Glyph Font::CreateGlyph(const FT_Face& face) const
 		glTexParameteri(GL_TEXTURE_2D, parameter, value);
 	}
 
-	const Glyph glyph{
-		textureID,
-		glm::ivec2{ face->glyph->bitmap.width, face->glyph->bitmap.rows },
-		glm::ivec2{ face->glyph->bitmap_left, face->glyph->bitmap_top },
-		static_cast<unsigned int>(face->glyph->advance.x)
-	};
-
-	return glyph;
+	RenderState::BindTexture(GL_TEXTURE_2D, 0);
 }
+
+void Font::Destroy() noexcept
+{
+	if (m_atlasID != 0)
+	{
+		RenderState::OnTextureDeleted(m_atlasID);
+		glDeleteTextures(1, &m_atlasID);
+		m_atlasID = 0;
+	}
+}
\ No newline at end of file
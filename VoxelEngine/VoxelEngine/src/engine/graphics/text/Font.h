@@ -9,8 +9,10 @@
 #include <glad/glad.h>
 #include <glm/glm.hpp>
 
+#include <array>
+#include <cstddef>
 #include <string>
-#include <unordered_map>
+#include <vector>
 
 class Font
 	: private INoncopyable
@@ -18,16 +20,31 @@ class Font
 public:
 	struct Glyph
 	{
-		GLuint textureID;
+		glm::ivec2 size{ 0, 0 };
+		glm::ivec2 bearing{ 0, 0 };
 
-		glm::ivec2 size;
-		glm::ivec2 bearing;
+		unsigned int advance = 0;
 
-		unsigned int advance;
+		glm::vec2 textureMin{ 0.0f, 0.0f };
+		glm::vec2 textureMax{ 0.0f, 0.0f };
 	};
 
 private:
-	std::unordered_map<char, Glyph> m_glyphs;
+	struct GlyphBitmap
+	{
+		glm::uvec2 size{ 0u, 0u };
+		std::vector<unsigned char> pixels;
+	};
+
+	static constexpr size_t s_GlyphCount = 128u;
+	static constexpr unsigned int s_AtlasWidth = 512u;
+	static constexpr unsigned int s_AtlasPadding = 1u;
+	static constexpr char s_ReplacementCharacter = '?';
+
+	GLuint m_atlasID = 0;
+	glm::uvec2 m_atlasSize{ 0u, 0u };
+
+	std::array<Glyph, s_GlyphCount> m_glyphs{ };
 
 public:
 	Font(const std::string& fontFilepath, const unsigned int fontSize);
@@ -35,12 +52,16 @@ public:
 	Font(Font&& other) noexcept;
 	Font& operator =(Font&& other) noexcept;
 
-	~Font() noexcept = default;
+	~Font() noexcept;
+
+	void Bind() const;
 
-	inline const std::unordered_map<char, Glyph>& GetGlyphs() const noexcept { return m_glyphs; }
+	inline const Glyph& GetGlyph(const char character) const noexcept { return m_glyphs[static_cast<unsigned char>(character) < s_GlyphCount ? static_cast<unsigned char>(character) : s_ReplacementCharacter]; }
+	inline const glm::uvec2& GetAtlasSize() const noexcept { return m_atlasSize; }
 
 private:
-	Glyph CreateGlyph(const FT_Face& face) const;
+	void CreateAtlas(const std::array<GlyphBitmap, s_GlyphCount>& bitmaps);
+	void Destroy() noexcept;
 };
 
 #endif
\ No newline at end of file
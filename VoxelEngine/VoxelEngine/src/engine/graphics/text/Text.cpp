@@ -1,23 +1,25 @@
 #include "Text.h"
 
+#include <algorithm>
 #include <array>
 #include <utility>
 
-#include "../Vertex.h"
-
-#include <iostream>
+#include "../RenderState.h"
 
 Text::Text(const Font& font, const ShaderProgram& shader)
-	: m_font(&font), m_shader(&shader)
+	: m_font(&font), m_shader(&shader), m_colourUniform(shader.GetUniformHandle("u_TextColour"))
 {
 	InitialiseVertexObjects();
 }
 
 Text::Text(Text&& other) noexcept
-	: Drawable(std::move(other)), m_font(other.m_font), m_shader(other.m_shader)
+	: Drawable(std::move(other)), m_font(other.m_font), m_shader(other.m_shader), m_colourUniform(other.m_colourUniform), m_text(std::move(other.m_text)), m_position(other.m_position), m_scale(other.m_scale),
+	  m_vertices(std::move(other.m_vertices)), m_glyphCapacity(other.m_glyphCapacity), m_elementCount(other.m_elementCount), m_rebuildCount(other.m_rebuildCount)
 {
 	other.m_font = nullptr;
 	other.m_shader = nullptr;
+	other.m_glyphCapacity = 0;
+	other.m_elementCount = 0;
 }
 
 Text& Text::operator=(Text&& other) noexcept
@@ -26,69 +28,138 @@ Text& Text::operator=(Text&& other) noexcept
 
 	m_font = std::exchange(other.m_font, nullptr);
 	m_shader = std::exchange(other.m_shader, nullptr);
+	m_colourUniform = other.m_colourUniform;
+
+	m_text = std::move(other.m_text);
+	m_position = other.m_position;
+	m_scale = other.m_scale;
+
+	m_vertices = std::move(other.m_vertices);
+	m_glyphCapacity = std::exchange(other.m_glyphCapacity, 0);
+	m_elementCount = std::exchange(other.m_elementCount, 0);
+	m_rebuildCount = other.m_rebuildCount;
 
 	return *this;
 }
 
-void Text::Render(const std::string& text, glm::vec2 position, const float scale, const glm::vec3& colour)
+void Text::Render(const std::string_view text, const glm::vec2& position, const float scale, const glm::vec3& colour)
 {
+	if (text != m_text || position != m_position || scale != m_scale)
+	{
+		Rebuild(text, position, scale);
+	}
+
+	if (m_elementCount == 0)
+	{
+		return;
+	}
+
 	m_shader->Use();
-	m_shader->SetUniform<glm::vec3>("u_TextColour", colour);
+	m_shader->SetUniform<glm::vec3>(m_colourUniform, colour);
+
+	RenderState::SetActiveTextureUnit(GL_TEXTURE0);
+	m_font->Bind();
 
-	glActiveTexture(GL_TEXTURE0);
-	glBindVertexArray(m_vao);
+	RenderState::BindVertexArray(m_vao);
+	glDrawElements(GL_TRIANGLES, static_cast<GLsizei>(m_elementCount), GL_UNSIGNED_SHORT, nullptr);
+}
+
+void Text::InitialiseVertexObjects() const
+{
+	RenderState::BindVertexArray(m_vao);
+
+	glBindBuffer(GL_ARRAY_BUFFER, m_vbo);
+	glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, m_ebo);
+
+	glEnableVertexAttribArray(Position);
+	glVertexAttribPointer(Position, 2, GL_FLOAT, GL_FALSE, sizeof(Vertex2D), reinterpret_cast<const GLvoid*>(offsetof(Vertex2D, position)));
+
+	glEnableVertexAttribArray(TextureCoordinates);
+	glVertexAttribPointer(TextureCoordinates, 2, GL_FLOAT, GL_FALSE, sizeof(Vertex2D), reinterpret_cast<const GLvoid*>(offsetof(Vertex2D, textureCoordinates)));
+
+	RenderState::BindVertexArray(0);
+	glBindBuffer(GL_ARRAY_BUFFER, 0);
+	glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, 0);
+}
+
+void Text::Rebuild(const std::string_view text, const glm::vec2& position, const float scale)
+{
+	m_text = text;
+	m_position = position;
+	m_scale = scale;
+	++m_rebuildCount;
+
+	m_vertices.clear();
+
+	constexpr char TallestCharacter = 'H';
+	const float baseline = static_cast<float>(m_font->GetGlyph(TallestCharacter).bearing.y);
+	float xOrigin = position.x;
 
 	for (const char character : text)
 	{
-		const Font::Glyph& currentGlyph = m_font->GetGlyphs().at(character);
+		const Font::Glyph& glyph = m_font->GetGlyph(character);
 
-		constexpr char TallestCharacter = 'H';
-		const float xPosition = position.x + currentGlyph.bearing.x * scale;
-		const float yPosition = position.y + (m_font->GetGlyphs().at(TallestCharacter).bearing.y - currentGlyph.bearing.y) * scale;
+		const float xPosition = xOrigin + glyph.bearing.x * scale;
+		const float yPosition = position.y + (baseline - glyph.bearing.y) * scale;
 
-		const float width = currentGlyph.size.x * scale;
-		const float height = currentGlyph.size.y * scale;
+		const float width = glyph.size.x * scale;
+		const float height = glyph.size.y * scale;
 
-		const std::array<Vertex2D, 4u> vertices{
-			Vertex2D{ { xPosition, yPosition + height }, { 0.0f, 1.0f } },
-			Vertex2D{ { xPosition + width, yPosition }, { 1.0f, 0.0f } },
-			Vertex2D{ { xPosition, yPosition }, { 0.0f, 0.0f } },
-			Vertex2D{ { xPosition + width, yPosition + height }, { 1.0f, 1.0f } }
-		};
+		xOrigin += (glyph.advance >> 6) * scale;
 
-		glBindTexture(GL_TEXTURE_2D, currentGlyph.textureID);
+		if (glyph.size.x == 0 || glyph.size.y == 0)
+		{
+			continue;
+		}
 
-		glBindBuffer(GL_ARRAY_BUFFER, m_vbo);
-		glBufferSubData(GL_ARRAY_BUFFER, 0, sizeof(vertices), vertices.data());
-		glBindBuffer(GL_ARRAY_BUFFER, 0);
+		if (m_vertices.size() == s_MaxGlyphCount * vertices::QuadVertices.size())
+		{
+			break;
+		}
 
+		m_vertices.push_back(Vertex2D{ { xPosition, yPosition + height }, { glyph.textureMin.x, glyph.textureMax.y } });
+		m_vertices.push_back(Vertex2D{ { xPosition + width, yPosition }, { glyph.textureMax.x, glyph.textureMin.y } });
+		m_vertices.push_back(Vertex2D{ { xPosition, yPosition }, { glyph.textureMin.x, glyph.textureMin.y } });
+		m_vertices.push_back(Vertex2D{ { xPosition + width, yPosition + height }, { glyph.textureMax.x, glyph.textureMax.y } });
+	}
 
-		glDrawElements(GL_TRIANGLES, 6, GL_UNSIGNED_SHORT, nullptr);
+	const size_t glyphCount = m_vertices.size() / vertices::QuadVertices.size();
+	ReserveGlyphs(glyphCount);
 
-		position.x += (currentGlyph.advance >> 6) * scale;
-	}
+	glBindBuffer(GL_ARRAY_BUFFER, m_vbo);
+	glBufferSubData(GL_ARRAY_BUFFER, 0, m_vertices.size() * sizeof(Vertex2D), m_vertices.data());
+	glBindBuffer(GL_ARRAY_BUFFER, 0);
 
-	glBindVertexArray(0);
-	glBindTexture(GL_TEXTURE_2D, 0);
+	m_elementCount = glyphCount * vertices::QuadIndices.size();
 }
 
-void Text::InitialiseVertexObjects() const
+void Text::ReserveGlyphs(const size_t glyphCount)
 {
-	glBindVertexArray(m_vao);
+	if (glyphCount <= m_glyphCapacity)
+	{
+		return;
+	}
 
-	glBindBuffer(GL_ARRAY_BUFFER, m_vbo);
-	glBufferData(GL_ARRAY_BUFFER, 4 * sizeof(Vertex2D), nullptr, GL_DYNAMIC_DRAW);
+	m_glyphCapacity = std::min(std::max(glyphCount, m_glyphCapacity * 2), s_MaxGlyphCount);
 
-	glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, m_ebo);
-	glBufferData(GL_ELEMENT_ARRAY_BUFFER, vertices::QuadIndices.size() * sizeof(unsigned short), vertices::QuadIndices.data(), GL_STATIC_DRAW);
+	std::vector<unsigned short> elements;
+	elements.reserve(m_glyphCapacity * vertices::QuadIndices.size());
 
-	glEnableVertexAttribArray(Position);
-	glVertexAttribPointer(Position, 2, GL_FLOAT, GL_FALSE, sizeof(Vertex2D), reinterpret_cast<const GLvoid*>(offsetof(Vertex2D, position)));
+	for (size_t glyph = 0; glyph < m_glyphCapacity; ++glyph)
+	{
+		for (const unsigned short index : vertices::QuadIndices)
+		{
+			elements.push_back(static_cast<unsigned short>(glyph * vertices::QuadVertices.size() + index));
+		}
+	}
 
-	glEnableVertexAttribArray(TextureCoordinates);
-	glVertexAttribPointer(TextureCoordinates, 2, GL_FLOAT, GL_FALSE, sizeof(Vertex2D), reinterpret_cast<const GLvoid*>(offsetof(Vertex2D, textureCoordinates)));
+	RenderState::BindVertexArray(0);
 
-	glBindVertexArray(0);
+	glBindBuffer(GL_ARRAY_BUFFER, m_vbo);
+	glBufferData(GL_ARRAY_BUFFER, m_glyphCapacity * vertices::QuadVertices.size() * sizeof(Vertex2D), nullptr, GL_DYNAMIC_DRAW);
 	glBindBuffer(GL_ARRAY_BUFFER, 0);
+
+	glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, m_ebo);
+	glBufferData(GL_ELEMENT_ARRAY_BUFFER, elements.size() * sizeof(unsigned short), elements.data(), GL_STATIC_DRAW);
 	glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, 0);
 }
\ No newline at end of file
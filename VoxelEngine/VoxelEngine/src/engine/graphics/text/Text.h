@@ -7,17 +7,34 @@
 #include <glad/glad.h>
 #include <glm/glm.hpp>
 
+#include <cstddef>
+#include <limits>
 #include <string>
+#include <string_view>
+#include <vector>
 
 #include "../shaders/ShaderProgram.h"
+#include "../Vertex.h"
 #include "Font.h"
 
 class Text
 	: public Drawable
 {
 private:
+	static constexpr size_t s_MaxGlyphCount = (static_cast<size_t>(std::numeric_limits<unsigned short>::max()) + 1u) / vertices::QuadVertices.size();
+
 	const Font* m_font = nullptr;
 	const ShaderProgram* m_shader = nullptr;
+	ShaderProgram::UniformHandle m_colourUniform;
+
+	std::string m_text;
+	glm::vec2 m_position{ 0.0f, 0.0f };
+	float m_scale = 0.0f;
+
+	std::vector<Vertex2D> m_vertices;
+	size_t m_glyphCapacity = 0;
+	size_t m_elementCount = 0;
+	size_t m_rebuildCount = 0;
 
 public:
 	Text(const Font& font, const ShaderProgram& shader);
@@ -27,10 +44,15 @@ public:
 
 	virtual ~Text() noexcept override = default;
 
-	void Render(const std::string& text, glm::vec2 position, const float scale, const glm::vec3& colour = glm::vec3{ 1.0f });
+	void Render(const std::string_view text, const glm::vec2& position, const float scale, const glm::vec3& colour = glm::vec3{ 1.0f });
+
+	inline size_t GetRebuildCount() const noexcept { return m_rebuildCount; }
 
 private:
 	void InitialiseVertexObjects() const;
+
+	void Rebuild(const std::string_view text, const glm::vec2& position, const float scale);
+	void ReserveGlyphs(const size_t glyphCount);
 };
 
 #endif
\ No newline at end of file
@@ -1,6 +1,6 @@
 #include "ShaderManager.h"
 
-void ShaderManager::AddShader(const std::string& name, const std::initializer_list<Shader>& shaders)
+void ShaderManager::AddShader(const std::string& name, const std::initializer_list<ShaderProgram::ShaderFile>& shaderFiles)
 {
-	Add(name, shaders);
+	Add(name, shaderFiles, m_binaryCache);
 }
\ No newline at end of file
@@ -5,17 +5,26 @@
 #include "AssetManager.h"
 
 #include <initializer_list>
+#include <string>
 
+#include "../../graphics/shaders/ProgramBinaryCache.h"
 #include "../../graphics/shaders/ShaderProgram.h"
 
 class ShaderManager
 	: public AssetManager<ShaderProgram>
 {
+private:
+	inline static const std::string s_binaryCacheDirectory = "cache/shaders";
+
+	ProgramBinaryCache m_binaryCache{ s_binaryCacheDirectory };
+
 public:
 	ShaderManager() = default;
 	virtual ~ShaderManager() noexcept override = default;
 
-	void AddShader(const std::string& name, const std::initializer_list<Shader>& shaders);
+	void AddShader(const std::string& name, const std::initializer_list<ShaderProgram::ShaderFile>& shaderFiles);
+
+	inline const ProgramBinaryCache::Statistics& GetBinaryCacheStatistics() const noexcept { return m_binaryCache.GetStatistics(); }
 };
 
 #endif
\ No newline at end of file
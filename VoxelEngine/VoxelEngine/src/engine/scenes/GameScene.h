@@ -28,7 +28,8 @@ public:
 	virtual void PollEvents(const SDL_Event& gameEvent) = 0;
 	virtual void ProcessInput(const KeyboardState& keyboardState, const MouseState& mouseState, const Sint32 scrollState, const GameControllerState& gameControllerState) = 0;
 	virtual void Update(const float deltaTime) = 0;
-	virtual void Render() const = 0;
+	virtual void LateUpdate() = 0;
+	virtual void Render(const float interpolation) const = 0;
 };
 
 #endif
\ No newline at end of file
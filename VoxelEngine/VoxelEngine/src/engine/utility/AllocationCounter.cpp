@@ -0,0 +1,50 @@
+#include "AllocationCounter.h"
+
+#include <cstdlib>
+#include <new>
+
+// Counted per thread so that worker threads meshing and generating chunks do not show up in the render thread's numbers.
+static thread_local size_t s_threadAllocationCount = 0;
+
+size_t AllocationCounter::GetThreadAllocationCount() noexcept
+{
+	return s_threadAllocationCount;
+}
+
+void* operator new(const size_t size)
+{
+	++s_threadAllocationCount;
+
+	if (void* const memory = std::malloc(size == 0 ? 1 : size);
+		memory != nullptr)
+	{
+		return memory;
+	}
+
+	throw std::bad_alloc();
+}
+
+void* operator new[](const size_t size)
+{
+	return operator new(size);
+}
+
+void operator delete(void* const memory) noexcept
+{
+	std::free(memory);
+}
+
+void operator delete[](void* const memory) noexcept
+{
+	std::free(memory);
+}
+
+void operator delete(void* const memory, const size_t) noexcept
+{
+	std::free(memory);
+}
+
+void operator delete[](void* const memory, const size_t) noexcept
+{
+	std::free(memory);
+}
\ No newline at end of file
@@ -0,0 +1,16 @@
+#pragma once
+#ifndef ALLOCATION_COUNTER_H
+#define ALLOCATION_COUNTER_H
+
+#include <cstddef>
+
+class AllocationCounter
+{
+public:
+	AllocationCounter() = delete;
+	~AllocationCounter() noexcept = delete;
+
+	static size_t GetThreadAllocationCount() noexcept;
+};
+
+#endif
\ No newline at end of file
@@ -0,0 +1,55 @@
+#pragma once
+#ifndef COUNTER_RANDOM_H
+#define COUNTER_RANDOM_H
+
+#include <glm/glm.hpp>
+
+#include <cstdint>
+#include <type_traits>
+
+class CounterRandom
+{
+private:
+	static constexpr std::uint64_t s_Gamma = 0x9E3779B97F4A7C15ull;
+
+	std::uint64_t m_key = 0;
+	std::uint64_t m_counter = 0;
+
+public:
+	static constexpr std::uint64_t Mix(std::uint64_t value) noexcept
+	{
+		value = (value ^ (value >> 30u)) * 0xBF58476D1CE4E5B9ull;
+		value = (value ^ (value >> 27u)) * 0x94D049BB133111EBull;
+
+		return value ^ (value >> 31u);
+	}
+
+	CounterRandom(const std::uint64_t seed, const glm::ivec3& position) noexcept
+	{
+		m_key = Mix(seed + s_Gamma);
+		m_key = Mix(m_key ^ static_cast<std::uint32_t>(position.x));
+		m_key = Mix(m_key ^ static_cast<std::uint32_t>(position.y));
+		m_key = Mix(m_key ^ static_cast<std::uint32_t>(position.z));
+	}
+
+	~CounterRandom() noexcept = default;
+
+	inline std::uint64_t Next() noexcept
+	{
+		++m_counter;
+
+		return Mix(m_key + m_counter * s_Gamma);
+	}
+
+	template <typename T = int, typename = std::enable_if_t<std::is_integral_v<T>>>
+	T GenerateInt(const T& min, const T& max) noexcept
+	{
+		const std::uint64_t range = static_cast<std::uint64_t>(max) - static_cast<std::uint64_t>(min) + 1u;
+
+		return static_cast<T>(static_cast<std::uint64_t>(min) + (range == 0 ? Next() : Next() % range));
+	}
+
+	inline std::uint64_t GetCounter() const noexcept { return m_counter; }
+};
+
+#endif
\ No newline at end of file
@@ -0,0 +1,62 @@
+#include "FixedTimestep.h"
+
+#include <algorithm>
+#include <cmath>
+
+FixedTimestep::FixedTimestep(const unsigned int updateRate)
+	: m_counterFrequency(static_cast<double>(SDL_GetPerformanceFrequency())), m_previousCounter(SDL_GetPerformanceCounter()), m_stepTime(1.0 / static_cast<double>(std::max(updateRate, 1u)))
+{ }
+
+unsigned int FixedTimestep::BeginFrame()
+{
+	const Uint64 currentCounter = SDL_GetPerformanceCounter();
+	const double frameTime = static_cast<double>(currentCounter - m_previousCounter) / m_counterFrequency;
+	m_previousCounter = currentCounter;
+
+	m_accumulatedTime += std::min(frameTime, s_MaxFrameTime);
+
+	const unsigned int updateCount = static_cast<unsigned int>(m_accumulatedTime / m_stepTime);
+	m_accumulatedTime -= updateCount * m_stepTime;
+
+	RecordFrame(frameTime, updateCount);
+
+	return updateCount;
+}
+
+void FixedTimestep::Reset() noexcept
+{
+	m_previousCounter = SDL_GetPerformanceCounter();
+	m_accumulatedTime = 0.0;
+}
+
+void FixedTimestep::RecordFrame(const double frameTime, const unsigned int updateCount) noexcept
+{
+	m_minFrameTime = m_frameCount == 0 ? frameTime : std::min(m_minFrameTime, frameTime);
+	m_maxFrameTime = m_frameCount == 0 ? frameTime : std::max(m_maxFrameTime, frameTime);
+
+	++m_frameCount;
+	m_updateCount += updateCount;
+	m_frameTimeSum += frameTime;
+	m_frameTimeSquaredSum += frameTime * frameTime;
+
+	if (m_frameTimeSum < s_StatisticsInterval)
+	{
+		return;
+	}
+
+	constexpr double MillisecondsPerSecond = 1'000.0;
+
+	const double averageFrameTime = m_frameTimeSum / m_frameCount;
+	const double frameTimeVariance = std::max(m_frameTimeSquaredSum / m_frameCount - averageFrameTime * averageFrameTime, 0.0);
+
+	m_lastStatistics.averageFrameTime = static_cast<float>(averageFrameTime * MillisecondsPerSecond);
+	m_lastStatistics.minFrameTime = static_cast<float>(m_minFrameTime * MillisecondsPerSecond);
+	m_lastStatistics.maxFrameTime = static_cast<float>(m_maxFrameTime * MillisecondsPerSecond);
+	m_lastStatistics.frameTimeDeviation = static_cast<float>(std::sqrt(frameTimeVariance) * MillisecondsPerSecond);
+	m_lastStatistics.averageUpdateCount = static_cast<float>(m_updateCount) / m_frameCount;
+
+	m_frameCount = 0;
+	m_updateCount = 0;
+	m_frameTimeSum = 0.0;
+	m_frameTimeSquaredSum = 0.0;
+}
\ No newline at end of file
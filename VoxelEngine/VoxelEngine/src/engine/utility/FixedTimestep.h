@@ -0,0 +1,54 @@
+#pragma once
+#ifndef FIXED_TIMESTEP_H
+#define FIXED_TIMESTEP_H
+
+#include <SDL2/SDL.h>
+
+#include <cstddef>
+
+class FixedTimestep
+{
+public:
+	struct Statistics
+	{
+		float averageFrameTime = 0.0f;
+		float minFrameTime = 0.0f;
+		float maxFrameTime = 0.0f;
+		float frameTimeDeviation = 0.0f;
+		float averageUpdateCount = 0.0f;
+	};
+
+private:
+	static constexpr double s_MaxFrameTime = 0.25;
+	static constexpr double s_StatisticsInterval = 1.0;
+
+	double m_counterFrequency = 0.0;
+	Uint64 m_previousCounter = 0;
+
+	double m_stepTime = 0.0;
+	double m_accumulatedTime = 0.0;
+
+	size_t m_frameCount = 0;
+	size_t m_updateCount = 0;
+	double m_frameTimeSum = 0.0;
+	double m_frameTimeSquaredSum = 0.0;
+	double m_minFrameTime = 0.0;
+	double m_maxFrameTime = 0.0;
+	Statistics m_lastStatistics;
+
+public:
+	explicit FixedTimestep(const unsigned int updateRate);
+	~FixedTimestep() noexcept = default;
+
+	unsigned int BeginFrame();
+	void Reset() noexcept;
+
+	inline float GetStepTime() const noexcept { return static_cast<float>(m_stepTime); }
+	inline float GetInterpolationAlpha() const noexcept { return static_cast<float>(m_accumulatedTime / m_stepTime); }
+	inline const Statistics& GetStatistics() const noexcept { return m_lastStatistics; }
+
+private:
+	void RecordFrame(const double frameTime, const unsigned int updateCount) noexcept;
+};
+
+#endif
\ No newline at end of file
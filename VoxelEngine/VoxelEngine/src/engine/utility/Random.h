@@ -8,8 +8,8 @@
 class Random
 {
 private:
-	inline static std::random_device s_randomSeed;
-	inline static std::mt19937 s_randomEngine{ s_randomSeed() };
+	inline static thread_local std::random_device s_randomSeed;
+	inline static thread_local std::mt19937 s_randomEngine{ s_randomSeed() };
 
 public:
 	Random() = delete;
@@ -0,0 +1,241 @@
+#include "SimplexNoise.h"
+
+#include <glm/gtc/noise.hpp>
+
+#include <intrin.h>
+
+void SimplexNoise::Generate2D(const std::vector<glm::vec2>& positions, std::vector<float>& values)
+{
+	Generate2D(positions, values, GetSupportedInstructionSet());
+}
+
+void SimplexNoise::Generate2D(const std::vector<glm::vec2>& positions, std::vector<float>& values, const InstructionSet instructionSet)
+{
+	values.resize(positions.size());
+
+	switch (instructionSet)
+	{
+	case InstructionSet::AVX:
+		Generate2DAVX(positions.data(), values.data(), positions.size());
+
+		break;
+
+	case InstructionSet::SSE2:
+		Generate2DSSE2(positions.data(), values.data(), positions.size());
+
+		break;
+
+	case InstructionSet::Scalar:
+	default:
+		Generate2DScalar(positions.data(), values.data(), positions.size());
+
+		break;
+	}
+}
+
+SimplexNoise::InstructionSet SimplexNoise::GetSupportedInstructionSet() noexcept
+{
+	static const InstructionSet supportedInstructionSet = DetectInstructionSet();
+
+	return supportedInstructionSet;
+}
+
+SimplexNoise::InstructionSet SimplexNoise::DetectInstructionSet() noexcept
+{
+	constexpr int SSE2Bit = 1 << 26;
+	constexpr int OSXSAVEBit = 1 << 27;
+	constexpr int AVXBit = 1 << 28;
+	constexpr unsigned long long AVXStateMask = 0x6ull;
+
+	int cpuInfo[4]{ };
+	__cpuid(cpuInfo, 1);
+
+	if ((cpuInfo[2] & OSXSAVEBit) && (cpuInfo[2] & AVXBit) && (_xgetbv(0) & AVXStateMask) == AVXStateMask)
+	{
+		return InstructionSet::AVX;
+	}
+
+	return (cpuInfo[3] & SSE2Bit) ? InstructionSet::SSE2 : InstructionSet::Scalar;
+}
+
+void SimplexNoise::Generate2DScalar(const glm::vec2* positions, float* values, const size_t count) noexcept
+{
+	for (size_t i = 0; i < count; ++i)
+	{
+		values[i] = glm::simplex(positions[i]);
+	}
+}
+
+void SimplexNoise::Generate2DSSE2(const glm::vec2* positions, float* values, const size_t count) noexcept
+{
+	constexpr size_t LaneCount = 4u;
+	size_t i = 0;
+
+	for (; i + LaneCount <= count; i += LaneCount)
+	{
+		const __m128 lowerPositions = _mm_loadu_ps(&positions[i].x);
+		const __m128 upperPositions = _mm_loadu_ps(&positions[i + 2].x);
+
+		const __m128 x = _mm_shuffle_ps(lowerPositions, upperPositions, _MM_SHUFFLE(2, 0, 2, 0));
+		const __m128 y = _mm_shuffle_ps(lowerPositions, upperPositions, _MM_SHUFFLE(3, 1, 3, 1));
+
+		_mm_storeu_ps(values + i, Simplex2DSSE2(x, y));
+	}
+
+	Generate2DScalar(positions + i, values + i, count - i);
+}
+
+__m128 SimplexNoise::Simplex2DSSE2(const __m128 x, const __m128 y) noexcept
+{
+	const __m128 one = _mm_set1_ps(1.0f);
+	const __m128 unskewFactor = _mm_set1_ps(s_UnskewFactor);
+	const __m128 permutationSize = _mm_set1_ps(s_PermutationSize);
+
+	const __m128 skew = _mm_add_ps(_mm_mul_ps(x, _mm_set1_ps(s_SkewFactor)), _mm_mul_ps(y, _mm_set1_ps(s_SkewFactor)));
+	__m128 cellX = FloorSSE2(_mm_add_ps(x, skew));
+	__m128 cellY = FloorSSE2(_mm_add_ps(y, skew));
+
+	const __m128 unskew = _mm_add_ps(_mm_mul_ps(cellX, unskewFactor), _mm_mul_ps(cellY, unskewFactor));
+	const __m128 x0 = _mm_add_ps(_mm_sub_ps(x, cellX), unskew);
+	const __m128 y0 = _mm_add_ps(_mm_sub_ps(y, cellY), unskew);
+
+	const __m128 isLowerTriangle = _mm_cmpgt_ps(x0, y0);
+	const __m128 middleCornerX = _mm_and_ps(isLowerTriangle, one);
+	const __m128 middleCornerY = _mm_andnot_ps(isLowerTriangle, one);
+
+	const __m128 x1 = _mm_sub_ps(_mm_add_ps(x0, unskewFactor), middleCornerX);
+	const __m128 y1 = _mm_sub_ps(_mm_add_ps(y0, unskewFactor), middleCornerY);
+	const __m128 x2 = _mm_add_ps(x0, _mm_set1_ps(s_LastCornerOffset));
+	const __m128 y2 = _mm_add_ps(y0, _mm_set1_ps(s_LastCornerOffset));
+
+	cellX = _mm_sub_ps(cellX, _mm_mul_ps(permutationSize, FloorSSE2(_mm_div_ps(cellX, permutationSize))));
+	cellY = _mm_sub_ps(cellY, _mm_mul_ps(permutationSize, FloorSSE2(_mm_div_ps(cellY, permutationSize))));
+
+	const __m128 hash0 = PermuteSSE2(_mm_add_ps(PermuteSSE2(cellY), cellX));
+	const __m128 hash1 = PermuteSSE2(_mm_add_ps(_mm_add_ps(PermuteSSE2(_mm_add_ps(cellY, middleCornerY)), cellX), middleCornerX));
+	const __m128 hash2 = PermuteSSE2(_mm_add_ps(_mm_add_ps(PermuteSSE2(_mm_add_ps(cellY, one)), cellX), one));
+
+	const __m128 contribution0 = GetCornerContributionSSE2(hash0, x0, y0, _mm_sub_ps(_mm_set1_ps(0.5f), _mm_add_ps(_mm_mul_ps(x0, x0), _mm_mul_ps(y0, y0))));
+	const __m128 contribution1 = GetCornerContributionSSE2(hash1, x1, y1, _mm_sub_ps(_mm_set1_ps(0.5f), _mm_add_ps(_mm_mul_ps(x1, x1), _mm_mul_ps(y1, y1))));
+	const __m128 contribution2 = GetCornerContributionSSE2(hash2, x2, y2, _mm_sub_ps(_mm_set1_ps(0.5f), _mm_add_ps(_mm_mul_ps(x2, x2), _mm_mul_ps(y2, y2))));
+
+	return _mm_mul_ps(_mm_set1_ps(130.0f), _mm_add_ps(_mm_add_ps(contribution0, contribution1), contribution2));
+}
+
+__m128 SimplexNoise::GetCornerContributionSSE2(const __m128 hash, const __m128 x, const __m128 y, __m128 falloff) noexcept
+{
+	const __m128 half = _mm_set1_ps(0.5f);
+
+	falloff = _mm_max_ps(falloff, _mm_setzero_ps());
+	falloff = _mm_mul_ps(falloff, falloff);
+	falloff = _mm_mul_ps(falloff, falloff);
+
+	const __m128 scaledHash = _mm_mul_ps(hash, _mm_set1_ps(s_GradientScale));
+	const __m128 gradientX = _mm_sub_ps(_mm_mul_ps(_mm_set1_ps(2.0f), _mm_sub_ps(scaledHash, FloorSSE2(scaledHash))), _mm_set1_ps(1.0f));
+	const __m128 gradientY = _mm_sub_ps(_mm_andnot_ps(_mm_set1_ps(-0.0f), gradientX), half);
+	const __m128 gradientOffsetX = _mm_sub_ps(gradientX, FloorSSE2(_mm_add_ps(gradientX, half)));
+
+	const __m128 gradientLengthSquared = _mm_add_ps(_mm_mul_ps(gradientOffsetX, gradientOffsetX), _mm_mul_ps(gradientY, gradientY));
+	falloff = _mm_mul_ps(falloff, _mm_sub_ps(_mm_set1_ps(s_InverseSqrtBase), _mm_mul_ps(_mm_set1_ps(s_InverseSqrtSlope), gradientLengthSquared)));
+
+	return _mm_mul_ps(falloff, _mm_add_ps(_mm_mul_ps(gradientOffsetX, x), _mm_mul_ps(gradientY, y)));
+}
+
+__m128 SimplexNoise::PermuteSSE2(const __m128 value) noexcept
+{
+	const __m128 product = _mm_mul_ps(_mm_add_ps(_mm_mul_ps(value, _mm_set1_ps(34.0f)), _mm_set1_ps(1.0f)), value);
+
+	return _mm_sub_ps(product, _mm_mul_ps(FloorSSE2(_mm_mul_ps(product, _mm_set1_ps(1.0f / s_PermutationSize))), _mm_set1_ps(s_PermutationSize)));
+}
+
+__m128 SimplexNoise::FloorSSE2(const __m128 value) noexcept
+{
+	const __m128 truncatedValue = _mm_cvtepi32_ps(_mm_cvttps_epi32(value));
+
+	return _mm_sub_ps(truncatedValue, _mm_and_ps(_mm_cmpgt_ps(truncatedValue, value), _mm_set1_ps(1.0f)));
+}
+
+void SimplexNoise::Generate2DAVX(const glm::vec2* positions, float* values, const size_t count) noexcept
+{
+	constexpr size_t LaneCount = 8u;
+	size_t i = 0;
+
+	for (; i + LaneCount <= count; i += LaneCount)
+	{
+		const __m256 firstPositions = _mm256_loadu_ps(&positions[i].x);
+		const __m256 secondPositions = _mm256_loadu_ps(&positions[i + 4].x);
+
+		const __m256 lowerPositions = _mm256_permute2f128_ps(firstPositions, secondPositions, 0x20);
+		const __m256 upperPositions = _mm256_permute2f128_ps(firstPositions, secondPositions, 0x31);
+
+		const __m256 x = _mm256_shuffle_ps(lowerPositions, upperPositions, _MM_SHUFFLE(2, 0, 2, 0));
+		const __m256 y = _mm256_shuffle_ps(lowerPositions, upperPositions, _MM_SHUFFLE(3, 1, 3, 1));
+
+		_mm256_storeu_ps(values + i, Simplex2DAVX(x, y));
+	}
+
+	Generate2DSSE2(positions + i, values + i, count - i);
+}
+
+__m256 SimplexNoise::Simplex2DAVX(const __m256 x, const __m256 y) noexcept
+{
+	const __m256 one = _mm256_set1_ps(1.0f);
+	const __m256 unskewFactor = _mm256_set1_ps(s_UnskewFactor);
+	const __m256 permutationSize = _mm256_set1_ps(s_PermutationSize);
+
+	const __m256 skew = _mm256_add_ps(_mm256_mul_ps(x, _mm256_set1_ps(s_SkewFactor)), _mm256_mul_ps(y, _mm256_set1_ps(s_SkewFactor)));
+	__m256 cellX = _mm256_floor_ps(_mm256_add_ps(x, skew));
+	__m256 cellY = _mm256_floor_ps(_mm256_add_ps(y, skew));
+
+	const __m256 unskew = _mm256_add_ps(_mm256_mul_ps(cellX, unskewFactor), _mm256_mul_ps(cellY, unskewFactor));
+	const __m256 x0 = _mm256_add_ps(_mm256_sub_ps(x, cellX), unskew);
+	const __m256 y0 = _mm256_add_ps(_mm256_sub_ps(y, cellY), unskew);
+
+	const __m256 isLowerTriangle = _mm256_cmp_ps(x0, y0, _CMP_GT_OQ);
+	const __m256 middleCornerX = _mm256_and_ps(isLowerTriangle, one);
+	const __m256 middleCornerY = _mm256_andnot_ps(isLowerTriangle, one);
+
+	const __m256 x1 = _mm256_sub_ps(_mm256_add_ps(x0, unskewFactor), middleCornerX);
+	const __m256 y1 = _mm256_sub_ps(_mm256_add_ps(y0, unskewFactor), middleCornerY);
+	const __m256 x2 = _mm256_add_ps(x0, _mm256_set1_ps(s_LastCornerOffset));
+	const __m256 y2 = _mm256_add_ps(y0, _mm256_set1_ps(s_LastCornerOffset));
+
+	cellX = _mm256_sub_ps(cellX, _mm256_mul_ps(permutationSize, _mm256_floor_ps(_mm256_div_ps(cellX, permutationSize))));
+	cellY = _mm256_sub_ps(cellY, _mm256_mul_ps(permutationSize, _mm256_floor_ps(_mm256_div_ps(cellY, permutationSize))));
+
+	const __m256 hash0 = PermuteAVX(_mm256_add_ps(PermuteAVX(cellY), cellX));
+	const __m256 hash1 = PermuteAVX(_mm256_add_ps(_mm256_add_ps(PermuteAVX(_mm256_add_ps(cellY, middleCornerY)), cellX), middleCornerX));
+	const __m256 hash2 = PermuteAVX(_mm256_add_ps(_mm256_add_ps(PermuteAVX(_mm256_add_ps(cellY, one)), cellX), one));
+
+	const __m256 contribution0 = GetCornerContributionAVX(hash0, x0, y0, _mm256_sub_ps(_mm256_set1_ps(0.5f), _mm256_add_ps(_mm256_mul_ps(x0, x0), _mm256_mul_ps(y0, y0))));
+	const __m256 contribution1 = GetCornerContributionAVX(hash1, x1, y1, _mm256_sub_ps(_mm256_set1_ps(0.5f), _mm256_add_ps(_mm256_mul_ps(x1, x1), _mm256_mul_ps(y1, y1))));
+	const __m256 contribution2 = GetCornerContributionAVX(hash2, x2, y2, _mm256_sub_ps(_mm256_set1_ps(0.5f), _mm256_add_ps(_mm256_mul_ps(x2, x2), _mm256_mul_ps(y2, y2))));
+
+	return _mm256_mul_ps(_mm256_set1_ps(130.0f), _mm256_add_ps(_mm256_add_ps(contribution0, contribution1), contribution2));
+}
+
+__m256 SimplexNoise::GetCornerContributionAVX(const __m256 hash, const __m256 x, const __m256 y, __m256 falloff) noexcept
+{
+	const __m256 half = _mm256_set1_ps(0.5f);
+
+	falloff = _mm256_max_ps(falloff, _mm256_setzero_ps());
+	falloff = _mm256_mul_ps(falloff, falloff);
+	falloff = _mm256_mul_ps(falloff, falloff);
+
+	const __m256 scaledHash = _mm256_mul_ps(hash, _mm256_set1_ps(s_GradientScale));
+	const __m256 gradientX = _mm256_sub_ps(_mm256_mul_ps(_mm256_set1_ps(2.0f), _mm256_sub_ps(scaledHash, _mm256_floor_ps(scaledHash))), _mm256_set1_ps(1.0f));
+	const __m256 gradientY = _mm256_sub_ps(_mm256_andnot_ps(_mm256_set1_ps(-0.0f), gradientX), half);
+	const __m256 gradientOffsetX = _mm256_sub_ps(gradientX, _mm256_floor_ps(_mm256_add_ps(gradientX, half)));
+
+	const __m256 gradientLengthSquared = _mm256_add_ps(_mm256_mul_ps(gradientOffsetX, gradientOffsetX), _mm256_mul_ps(gradientY, gradientY));
+	falloff = _mm256_mul_ps(falloff, _mm256_sub_ps(_mm256_set1_ps(s_InverseSqrtBase), _mm256_mul_ps(_mm256_set1_ps(s_InverseSqrtSlope), gradientLengthSquared)));
+
+	return _mm256_mul_ps(falloff, _mm256_add_ps(_mm256_mul_ps(gradientOffsetX, x), _mm256_mul_ps(gradientY, y)));
+}
+
+__m256 SimplexNoise::PermuteAVX(const __m256 value) noexcept
+{
+	const __m256 product = _mm256_mul_ps(_mm256_add_ps(_mm256_mul_ps(value, _mm256_set1_ps(34.0f)), _mm256_set1_ps(1.0f)), value);
+
+	return _mm256_sub_ps(product, _mm256_mul_ps(_mm256_floor_ps(_mm256_mul_ps(product, _mm256_set1_ps(1.0f / s_PermutationSize))), _mm256_set1_ps(s_PermutationSize)));
+}
\ No newline at end of file
@@ -0,0 +1,57 @@
+#pragma once
+#ifndef SIMPLEX_NOISE_H
+#define SIMPLEX_NOISE_H
+
+#include <glm/glm.hpp>
+
+#include <immintrin.h>
+
+#include <cstddef>
+#include <vector>
+
+class SimplexNoise
+{
+public:
+	enum class InstructionSet
+	{
+		Scalar,
+		SSE2,
+		AVX
+	};
+
+private:
+	static constexpr float s_SkewFactor = static_cast<float>(0.366025403784439);
+	static constexpr float s_UnskewFactor = static_cast<float>(0.211324865405187);
+	static constexpr float s_LastCornerOffset = static_cast<float>(-0.577350269189626);
+	static constexpr float s_GradientScale = static_cast<float>(0.024390243902439);
+	static constexpr float s_InverseSqrtBase = static_cast<float>(1.79284291400159);
+	static constexpr float s_InverseSqrtSlope = static_cast<float>(0.85373472095314);
+	static constexpr float s_PermutationSize = 289.0f;
+
+public:
+	SimplexNoise() = delete;
+	~SimplexNoise() noexcept = delete;
+
+	static void Generate2D(const std::vector<glm::vec2>& positions, std::vector<float>& values);
+	static void Generate2D(const std::vector<glm::vec2>& positions, std::vector<float>& values, const InstructionSet instructionSet);
+
+	static InstructionSet GetSupportedInstructionSet() noexcept;
+
+private:
+	static InstructionSet DetectInstructionSet() noexcept;
+
+	static void Generate2DScalar(const glm::vec2* positions, float* values, const size_t count) noexcept;
+
+	static void Generate2DSSE2(const glm::vec2* positions, float* values, const size_t count) noexcept;
+	static __m128 Simplex2DSSE2(const __m128 x, const __m128 y) noexcept;
+	static __m128 GetCornerContributionSSE2(const __m128 hash, const __m128 x, const __m128 y, __m128 falloff) noexcept;
+	static __m128 PermuteSSE2(const __m128 value) noexcept;
+	static __m128 FloorSSE2(const __m128 value) noexcept;
+
+	static void Generate2DAVX(const glm::vec2* positions, float* values, const size_t count) noexcept;
+	static __m256 Simplex2DAVX(const __m256 x, const __m256 y) noexcept;
+	static __m256 GetCornerContributionAVX(const __m256 hash, const __m256 x, const __m256 y, __m256 falloff) noexcept;
+	static __m256 PermuteAVX(const __m256 value) noexcept;
+};
+
+#endif
\ No newline at end of file
@@ -0,0 +1,94 @@
+#include "ThreadPool.h"
+
+#include <algorithm>
+#include <utility>
+
+unsigned int ThreadPool::GetDefaultWorkerCount() noexcept
+{
+	return std::max(std::thread::hardware_concurrency(), 1u);
+}
+
+ThreadPool::ThreadPool(unsigned int workerCount)
+{
+	if (workerCount == 0)
+	{
+		workerCount = GetDefaultWorkerCount();
+	}
+
+	m_workers.reserve(workerCount);
+
+	for (unsigned int i = 0; i < workerCount; ++i)
+	{
+		m_workers.emplace_back(&ThreadPool::RunWorker, this);
+	}
+}
+
+ThreadPool::~ThreadPool() noexcept
+{
+	{
+		const std::lock_guard<std::mutex> lock(m_jobMutex);
+		m_isRunning = false;
+	}
+
+	m_jobAvailableCondition.notify_all();
+
+	for (auto& worker : m_workers)
+	{
+		worker.join();
+	}
+}
+
+void ThreadPool::Enqueue(std::function<void()> job)
+{
+	{
+		const std::lock_guard<std::mutex> lock(m_jobMutex);
+		m_jobs.push(std::move(job));
+	}
+
+	m_jobAvailableCondition.notify_one();
+}
+
+void ThreadPool::WaitForJobs()
+{
+	std::unique_lock<std::mutex> lock(m_jobMutex);
+
+	m_jobsFinishedCondition.wait(lock, [this]()
+	{
+		return m_jobs.empty() && m_activeJobCount == 0;
+	});
+}
+
+void ThreadPool::RunWorker()
+{
+	while (true)
+	{
+		std::function<void()> job;
+
+		{
+			std::unique_lock<std::mutex> lock(m_jobMutex);
+
+			m_jobAvailableCondition.wait(lock, [this]()
+			{
+				return !m_isRunning || !m_jobs.empty();
+			});
+
+			if (!m_isRunning && m_jobs.empty())
+			{
+				return;
+			}
+
+			job = std::move(m_jobs.front());
+			m_jobs.pop();
+			++m_activeJobCount;
+		}
+
+		job();
+
+		{
+			const std::lock_guard<std::mutex> lock(m_jobMutex);
+			--m_activeJobCount;
+		}
+
+		m_jobsFinishedCondition.notify_all();
+	}
+}
\ No newline at end of file
@@ -0,0 +1,45 @@
+#pragma once
+#ifndef THREAD_POOL_H
+#define THREAD_POOL_H
+
+#include "../interfaces/INoncopyable.h"
+#include "../interfaces/INonmovable.h"
+
+#include <condition_variable>
+#include <cstddef>
+#include <functional>
+#include <mutex>
+#include <queue>
+#include <thread>
+#include <vector>
+
+class ThreadPool
+	: private INoncopyable, private INonmovable
+{
+private:
+	std::vector<std::thread> m_workers;
+	std::queue<std::function<void()>> m_jobs;
+
+	std::mutex m_jobMutex;
+	std::condition_variable m_jobAvailableCondition;
+	std::condition_variable m_jobsFinishedCondition;
+
+	size_t m_activeJobCount = 0;
+	bool m_isRunning = true;
+
+public:
+	static unsigned int GetDefaultWorkerCount() noexcept;
+
+	explicit ThreadPool(unsigned int workerCount = 0u);
+	~ThreadPool() noexcept;
+
+	void Enqueue(std::function<void()> job);
+	void WaitForJobs();
+
+	inline size_t GetWorkerCount() const noexcept { return m_workers.size(); }
+
+private:
+	void RunWorker();
+};
+
+#endif
\ No newline at end of file
@@ -15,8 +15,18 @@ struct Config
 	unsigned int glVersionMinor = 3;
 
 	bool enableVsync = false;
+	unsigned int updateRate = 60;
 
 	unsigned int multisampleCount = 4;
+
+	unsigned int workerThreadCount = 0;
+	bool enableGreedyMeshing = false;
+
+	unsigned int chunkLoadRadius = 8;
+	unsigned int chunkUnloadRadius = 10;
+	unsigned int chunkLoadsPerFrame = 8;
+
+	std::string saveDirectory = "saves/world";
 };
 
 #endif
\ No newline at end of file
@@ -12,7 +12,14 @@ const std::unordered_map<std::string, ConfigReader::ParserFunction> ConfigReader
 	{ "gl-version-major", &ParseGLVersionMajor },
 	{ "gl-version-minor", &ParseGLVersionMinor },
 	{ "enable-vsync", &ParseEnableVsync },
-	{ "multisample-count", &ParseMultisampleCount }
+	{ "update-rate", &ParseUpdateRate },
+	{ "multisample-count", &ParseMultisampleCount },
+	{ "worker-thread-count", &ParseWorkerThreadCount },
+	{ "enable-greedy-meshing", &ParseEnableGreedyMeshing },
+	{ "chunk-load-radius", &ParseChunkLoadRadius },
+	{ "chunk-unload-radius", &ParseChunkUnloadRadius },
+	{ "chunk-loads-per-frame", &ParseChunkLoadsPerFrame },
+	{ "save-directory", &ParseSaveDirectory }
 };
 
 ConfigReader::ConfigReader()
@@ -113,9 +120,63 @@ bool ConfigReader::ParseEnableVsync(Config& config, const tinyxml2::XMLElement*
 	return CheckXMLResult(result);
 }
 
+bool ConfigReader::ParseUpdateRate(Config& config, const tinyxml2::XMLElement* const configElement)
+{
+	const auto result = configElement->QueryUnsignedText(&config.updateRate);
+
+	return CheckXMLResult(result) && config.updateRate > 0;
+}
+
 bool ConfigReader::ParseMultisampleCount(Config& config, const tinyxml2::XMLElement* const configElement)
 {
 	const auto result = configElement->QueryUnsignedText(&config.multisampleCount);
 
 	return CheckXMLResult(result);
+}
+
+bool ConfigReader::ParseWorkerThreadCount(Config& config, const tinyxml2::XMLElement* const configElement)
+{
+	const auto result = configElement->QueryUnsignedText(&config.workerThreadCount);
+
+	return CheckXMLResult(result);
+}
+
+bool ConfigReader::ParseEnableGreedyMeshing(Config& config, const tinyxml2::XMLElement* const configElement)
+{
+	const auto result = configElement->QueryBoolText(&config.enableGreedyMeshing);
+
+	return CheckXMLResult(result);
+}
+
+bool ConfigReader::ParseChunkLoadRadius(Config& config, const tinyxml2::XMLElement* const configElement)
+{
+	const auto result = configElement->QueryUnsignedText(&config.chunkLoadRadius);
+
+	return CheckXMLResult(result);
+}
+
+bool ConfigReader::ParseChunkUnloadRadius(Config& config, const tinyxml2::XMLElement* const configElement)
+{
+	const auto result = configElement->QueryUnsignedText(&config.chunkUnloadRadius);
+
+	return CheckXMLResult(result);
+}
+
+bool ConfigReader::ParseChunkLoadsPerFrame(Config& config, const tinyxml2::XMLElement* const configElement)
+{
+	const auto result = configElement->QueryUnsignedText(&config.chunkLoadsPerFrame);
+
+	return CheckXMLResult(result);
+}
+
+bool ConfigReader::ParseSaveDirectory(Config& config, const tinyxml2::XMLElement* const configElement)
+{
+	if (configElement->GetText() == nullptr)
+	{
+		return false;
+	}
+
+	config.saveDirectory = configElement->GetText();
+
+	return true;
 }
\ No newline at end of file
@@ -39,8 +39,18 @@ private:
 	bool ParseGLVersionMinor(Config& config, const tinyxml2::XMLElement* const configElement);
 
 	bool ParseEnableVsync(Config& config, const tinyxml2::XMLElement* const configElement);
+	bool ParseUpdateRate(Config& config, const tinyxml2::XMLElement* const configElement);
 
 	bool ParseMultisampleCount(Config& config, const tinyxml2::XMLElement* const configElement);
+
+	bool ParseWorkerThreadCount(Config& config, const tinyxml2::XMLElement* const configElement);
+	bool ParseEnableGreedyMeshing(Config& config, const tinyxml2::XMLElement* const configElement);
+
+	bool ParseChunkLoadRadius(Config& config, const tinyxml2::XMLElement* const configElement);
+	bool ParseChunkUnloadRadius(Config& config, const tinyxml2::XMLElement* const configElement);
+	bool ParseChunkLoadsPerFrame(Config& config, const tinyxml2::XMLElement* const configElement);
+
+	bool ParseSaveDirectory(Config& config, const tinyxml2::XMLElement* const configElement);
 };
 
 #endif
\ No newline at end of file
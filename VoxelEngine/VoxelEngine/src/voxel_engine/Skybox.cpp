@@ -3,6 +3,7 @@
 #include <utility>
 
 #include "../engine/graphics/Vertex.h"
+#include "../engine/graphics/RenderState.h"
 
 Skybox::Skybox(const ShaderProgram& shader, const Cubemap& cubemap)
 	: m_shader(&shader), m_cubemap(&cubemap)
@@ -27,22 +28,20 @@ Skybox& Skybox::operator=(Skybox&& other) noexcept
 	return *this;
 }
 
-void Skybox::Render(const glm::mat4& viewMatrix, const glm::mat4& projectionMatrix) const
+void Skybox::Render() const
 {
 	m_shader->Use();
-	m_shader->SetUniform("u_ViewProjection", projectionMatrix * viewMatrix);
 
-	glActiveTexture(GL_TEXTURE0);
+	RenderState::SetActiveTextureUnit(GL_TEXTURE0);
 	m_cubemap->Bind();
 
-	glBindVertexArray(m_vao);
+	RenderState::BindVertexArray(m_vao);
 	glDrawElements(GL_TRIANGLES, static_cast<GLsizei>(vertices::CubeIndices.size()), GL_UNSIGNED_SHORT, nullptr);
-	glBindVertexArray(0);
 }
 
 void Skybox::InitialiseVertexObjects() const
 {
-	glBindVertexArray(m_vao);
+	RenderState::BindVertexArray(m_vao);
 
 	glBindBuffer(GL_ARRAY_BUFFER, m_vbo);
 	glBufferData(GL_ARRAY_BUFFER, vertices::CubeVertices.size() * sizeof(Vertex2D), vertices::CubeVertices.data(), GL_STATIC_DRAW);
@@ -53,7 +52,7 @@ void Skybox::InitialiseVertexObjects() const
 	glEnableVertexAttribArray(Position);
 	glVertexAttribPointer(Position, 3, GL_FLOAT, GL_FALSE, 3 * sizeof(float), reinterpret_cast<const GLvoid*>(0));
 
-	glBindVertexArray(0);
+	RenderState::BindVertexArray(0);
 	glBindBuffer(GL_ARRAY_BUFFER, 0);
 	glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, 0);
 }
\ No newline at end of file
@@ -22,7 +22,7 @@ public:
 
 	~Skybox() noexcept = default;
 
-	void Render(const glm::mat4& viewMatrix, const glm::mat4& projectionMatrix) const;
+	void Render() const;
 
 private:
 	void InitialiseVertexObjects() const;
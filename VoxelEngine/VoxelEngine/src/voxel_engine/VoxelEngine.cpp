@@ -2,8 +2,14 @@
 
 #include <magic_enum/magic_enum.hpp>
 
+#include <chrono>
+#include <sstream>
+
 #include "../engine/Game.h"
 #include "../engine/audio/AudioContext.h"
+#include "../engine/graphics/RenderState.h"
+#include "../engine/utility/AllocationCounter.h"
+#include "../engine/utility/Logger.h"
 
 VoxelEngine::VoxelEngine(Game& game)
 	: GameScene(game)
@@ -12,25 +18,34 @@ VoxelEngine::VoxelEngine(Game& game)
 void VoxelEngine::OnLoad()
 {
 	m_orthogonalMatrix = glm::ortho(0.0f, static_cast<float>(m_game.GetWindowSize().x), static_cast<float>(m_game.GetWindowSize().y), 0.0f);
+	m_frameUniformBuffer = std::make_unique<UniformBuffer>(FrameUniforms::s_BindingPoint, sizeof(FrameUniforms));
+
+	const auto shaderStartTime = std::chrono::steady_clock::now();
 
-	m_shaders.AddShader("sprite", { Shader(Shader::Type::Vertex, "shaders/sprite.vert"), Shader(Shader::Type::Fragment, "shaders/sprite.frag") });
-	m_shaders["sprite"].Use();
-	m_shaders["sprite"].SetUniform<glm::mat4>("u_Projection", m_orthogonalMatrix);
-	m_shaders["sprite"].SetTextureUniform("u_SpriteTexture", 0);
+	m_shaders.AddShader("sprite_batch", { { Shader::Type::Vertex, "shaders/sprite_batch.vert" }, { Shader::Type::Fragment, "shaders/sprite_batch.frag" } });
+	m_shaders["sprite_batch"].Use();
+	m_shaders["sprite_batch"].SetTextureUniform("u_SpriteTexture", 0);
 
-	m_shaders.AddShader("chunk", { Shader(Shader::Type::Vertex, "shaders/chunk.vert"), Shader(Shader::Type::Fragment, "shaders/chunk.frag") });
+	m_shaders.AddShader("chunk", { { Shader::Type::Vertex, "shaders/chunk.vert" }, { Shader::Type::Fragment, "shaders/chunk.frag" } });
 	m_shaders["chunk"].Use();
 	m_shaders["chunk"].SetTextureUniform("u_BlockTexture", 0);
 
-	m_shaders.AddShader("skybox", { Shader(Shader::Type::Vertex, "shaders/skybox.vert"), Shader(Shader::Type::Fragment, "shaders/skybox.frag") });
+	m_shaders.AddShader("skybox", { { Shader::Type::Vertex, "shaders/skybox.vert" }, { Shader::Type::Fragment, "shaders/skybox.frag" } });
 	m_shaders["skybox"].Use();
 	m_shaders["skybox"].SetTextureUniform("u_SkyboxCubemap", 0);
 
-	m_shaders.AddShader("text", { Shader(Shader::Type::Vertex, "shaders/text.vert"), Shader(Shader::Type::Fragment, "shaders/text.frag") });
+	m_shaders.AddShader("text", { { Shader::Type::Vertex, "shaders/text.vert" }, { Shader::Type::Fragment, "shaders/text.frag" } });
 	m_shaders["text"].Use();
-	m_shaders["text"].SetUniform<glm::mat4>("u_Projection", m_orthogonalMatrix);
 	m_shaders["text"].SetTextureUniform("u_Text", 0);
 
+	const std::chrono::duration<float, std::milli> shaderLoadTime = std::chrono::steady_clock::now() - shaderStartTime;
+	const ProgramBinaryCache::Statistics& binaryCacheStatistics = m_shaders.GetBinaryCacheStatistics();
+
+	std::ostringstream messageStream;
+	messageStream << "Loaded shader programs in " << shaderLoadTime.count() << "ms: " << binaryCacheStatistics.hitCount << " from the program binary cache, " << binaryCacheStatistics.missCount << " compiled from source.";
+
+	Logger::Log(messageStream.str());
+
 	m_textures.AddTexture("crosshair", "assets/textures/crosshair.png");
 	m_textureArrays.AddTextureArray("blocks", "assets/textures/blocks.png", glm::uvec2{ 16, 16 });
 	m_cubemaps.AddCubemap("skybox", "assets/textures/cubemaps/skybox");
@@ -40,12 +55,17 @@ void VoxelEngine::OnLoad()
 	m_fonts.AddFont("font", "assets/fonts/AldotheApache.ttf", 48);
 
 	m_blockTileMap = std::make_unique<TileMap>(m_textureArrays["blocks"], glm::uvec2{ 16, 16 }, std::vector<std::string_view>{ "stone", "dirt", "grass_top", "grass_side", "bedrock", "log_top", "log_side", "leaves", "planks", "cobblestone", "glass", "pumpkin_bottom", "pumpkin_top", "pumpkin_side" });
-	m_world = std::make_unique<World>(*m_blockTileMap, m_camera, m_sounds["break"], m_sounds["place"], m_sounds["switch"], m_game);
+	m_world = std::make_unique<World>(*m_blockTileMap, m_camera, m_sounds["break"], m_sounds["place"], m_sounds["switch"], m_game.GetConfig());
 
 	m_skybox = std::make_unique<Skybox>(m_shaders["skybox"], m_cubemaps["skybox"]);
-	m_crosshair = std::make_unique<Sprite>(m_shaders["sprite"], m_textures["crosshair"]);
+	m_spriteBatch = std::make_unique<SpriteBatch>(m_shaders["sprite_batch"], s_SpriteBatchRegionSize);
 
 	m_selectedBlockText = std::make_unique<Text>(m_fonts["font"], m_shaders["text"]);
+	m_chunkStatisticsText = std::make_unique<Text>(m_fonts["font"], m_shaders["text"]);
+	m_chunkArenaText = std::make_unique<Text>(m_fonts["font"], m_shaders["text"]);
+	m_renderStateText = std::make_unique<Text>(m_fonts["font"], m_shaders["text"]);
+	m_frameStatisticsText = std::make_unique<Text>(m_fonts["font"], m_shaders["text"]);
+	m_renderAllocationText = std::make_unique<Text>(m_fonts["font"], m_shaders["text"]);
 }
 
 void VoxelEngine::OnUnload() noexcept
@@ -126,9 +146,6 @@ void VoxelEngine::PollEvents(const SDL_Event& gameEvent)
 			m_perspectiveMatrix = glm::perspective(glm::radians(m_camera.GetZoom()), static_cast<float>(m_game.GetWindowSize().x) / static_cast<float>(m_game.GetWindowSize().y), s_NearPlane, s_FarPlane);
 			m_orthogonalMatrix = glm::ortho(0.0f, static_cast<float>(m_game.GetWindowSize().x), static_cast<float>(m_game.GetWindowSize().y), 0.0f);
 
-			m_shaders["sprite"].Use();
-			m_shaders["sprite"].SetUniform<glm::mat4>("u_Projection", m_orthogonalMatrix);
-
 			break;
 
 		default:
@@ -147,11 +164,13 @@ void VoxelEngine::PollEvents(const SDL_Event& gameEvent)
 void VoxelEngine::ProcessInput(const KeyboardState& keyboardState, const MouseState& mouseState, const Sint32 scrollState, const GameControllerState& gameControllerState)
 {
 	m_camera.ProcessInput(keyboardState, mouseState, scrollState, gameControllerState);
-	m_world->ProcessInput(keyboardState, mouseState, scrollState, gameControllerState, m_perspectiveMatrix);
+	m_world->ProcessInput(keyboardState, mouseState, scrollState, gameControllerState);
 }
 
 void VoxelEngine::Update(const float deltaTime)
 {
+	m_elapsedTime += deltaTime;
+
 	m_camera.Update(deltaTime);
 	m_perspectiveMatrix = glm::perspective(glm::radians(m_camera.GetZoom()), static_cast<float>(m_game.GetWindowSize().x) / static_cast<float>(m_game.GetWindowSize().y), s_NearPlane, s_FarPlane);
 
@@ -159,16 +178,53 @@ void VoxelEngine::Update(const float deltaTime)
 	AudioContext::SetListenerOrientation(m_camera.GetFront(), glm::vec3{ 0.0f, 1.0f, 0.0f });
 }
 
-void VoxelEngine::Render() const
+void VoxelEngine::LateUpdate()
+{
+	m_world->Update();
+}
+
+void VoxelEngine::Render(const float interpolation) const
 {
+	const size_t startAllocationCount = AllocationCounter::GetThreadAllocationCount();
+
+	FrameUniforms frameUniforms;
+	frameUniforms.view = m_camera.GetInterpolatedViewMatrix(interpolation);
+	frameUniforms.projection = m_perspectiveMatrix;
+	frameUniforms.viewProjection = m_perspectiveMatrix * frameUniforms.view;
+	frameUniforms.orthographicProjection = m_orthogonalMatrix;
+	frameUniforms.cameraPosition = m_camera.GetInterpolatedPosition(interpolation);
+	frameUniforms.time = m_elapsedTime;
+	m_frameUniformBuffer->SetData(frameUniforms);
+
 	m_shaders["chunk"].Use();
-	m_shaders["chunk"].SetUniform<glm::mat4>("u_MVP", m_perspectiveMatrix * m_camera.GetViewMatrix());
-	m_world->Render();
+	m_world->Render(frameUniforms.viewProjection);
 
-	m_skybox->Render(glm::mat4(glm::mat3(m_camera.GetViewMatrix())), m_perspectiveMatrix);
+	m_skybox->Render();
 
 	constexpr float CrosshairSize = 24.0f;
-	m_crosshair->Render(glm::vec2{ m_game.GetWindowSize().x / 2.0f - (CrosshairSize / 2.0f), m_game.GetWindowSize().y / 2.0f - (CrosshairSize / 2.0f) }, glm::vec2{ CrosshairSize, CrosshairSize });
+	m_spriteBatch->Begin();
+	m_spriteBatch->Draw(m_textures["crosshair"], glm::vec2{ m_game.GetWindowSize().x / 2.0f - (CrosshairSize / 2.0f), m_game.GetWindowSize().y / 2.0f - (CrosshairSize / 2.0f) }, glm::vec2{ CrosshairSize, CrosshairSize });
+	m_spriteBatch->End();
+
+	// Every line is formatted into the same stack buffer, and Text only rebuilds its vertices when the string changes.
+	std::array<char, s_HUDTextBufferSize> textBuffer{ };
+
+	const std::string_view selectedBlockName = magic_enum::enum_name(m_world->GetSelectedBlock());
+	m_selectedBlockText->Render(FormatHUDText(textBuffer, "Selected block: %.*s", static_cast<int>(selectedBlockName.size()), selectedBlockName.data()), glm::vec2{ 5.0f, 5.0f }, 1.0f, glm::vec3{ 0.1f, 0.1f, 0.1f });
+
+	const World::RenderStatistics& renderStatistics = m_world->GetRenderStatistics();
+	m_chunkStatisticsText->Render(FormatHUDText(textBuffer, "Chunks: %zu visible, %zu culled, %zu empty", renderStatistics.visibleChunkCount, renderStatistics.culledChunkCount, renderStatistics.emptyChunkCount), glm::vec2{ 5.0f, 55.0f }, 0.5f, glm::vec3{ 0.1f, 0.1f, 0.1f });
+
+	const ChunkMeshArena::Statistics arenaStatistics = m_world->GetChunkMeshArenaStatistics();
+	m_chunkArenaText->Render(FormatHUDText(textBuffer, "Chunk arena: %zu/%zu KB, %zu allocations, %zu free blocks, %d%% fragmented", arenaStatistics.usedSize * sizeof(std::uint32_t) / 1024u, arenaStatistics.capacity * sizeof(std::uint32_t) / 1024u, arenaStatistics.allocationCount, arenaStatistics.freeBlockCount, static_cast<int>(arenaStatistics.fragmentation * 100.0f)), glm::vec2{ 5.0f, 80.0f }, 0.5f, glm::vec3{ 0.1f, 0.1f, 0.1f });
+
+	const RenderState::Statistics& renderStateStatistics = RenderState::GetLastFrameStatistics();
+	m_renderStateText->Render(FormatHUDText(textBuffer, "GL state calls: %zu issued, %zu skipped", renderStateStatistics.issuedCallCount, renderStateStatistics.skippedCallCount), glm::vec2{ 5.0f, 105.0f }, 0.5f, glm::vec3{ 0.1f, 0.1f, 0.1f });
+
+	const FixedTimestep::Statistics& frameStatistics = m_game.GetFrameStatistics();
+	m_frameStatisticsText->Render(FormatHUDText(textBuffer, "Frame time: %.2fms average, %.2f-%.2fms range, %.2fms jitter, %.2f updates per frame", frameStatistics.averageFrameTime, frameStatistics.minFrameTime, frameStatistics.maxFrameTime, frameStatistics.frameTimeDeviation, frameStatistics.averageUpdateCount), glm::vec2{ 5.0f, 130.0f }, 0.5f, glm::vec3{ 0.1f, 0.1f, 0.1f });
+
+	m_renderAllocationText->Render(FormatHUDText(textBuffer, "Render thread heap allocations: %zu last frame", m_lastRenderAllocationCount), glm::vec2{ 5.0f, 155.0f }, 0.5f, glm::vec3{ 0.1f, 0.1f, 0.1f });
 
-	m_selectedBlockText->Render("Selected block: " + std::string(magic_enum::enum_name(m_world->GetSelectedBlock())), glm::vec2{ 5.0f, 5.0f }, 1.0f, glm::vec3{ 0.1f, 0.1f, 0.1f });
+	m_lastRenderAllocationCount = AllocationCounter::GetThreadAllocationCount() - startAllocationCount;
 }
\ No newline at end of file
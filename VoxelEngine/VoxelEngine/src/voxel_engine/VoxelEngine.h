@@ -6,10 +6,17 @@
 
 #include <glm/glm.hpp>
 
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdio>
 #include <memory>
+#include <string_view>
 
 #include "../engine/camera/Camera3D.h"
-#include "../engine/graphics/Sprite.h"
+#include "../engine/graphics/shaders/FrameUniforms.h"
+#include "../engine/graphics/shaders/UniformBuffer.h"
+#include "../engine/graphics/SpriteBatch.h"
 #include "../engine/graphics/text/Text.h"
 #include "../engine/graphics/TileMap.h"
 #include "../engine/managers/assets/CubemapManager.h"
@@ -27,6 +34,8 @@ class VoxelEngine final
 private:
 	static constexpr float s_NearPlane = 0.1f;
 	static constexpr float s_FarPlane = 1000.0f;
+	static constexpr size_t s_SpriteBatchRegionSize = 1'024u;
+	static constexpr size_t s_HUDTextBufferSize = 256u;
 
 	ShaderManager m_shaders;
 	TextureManager m_textures;
@@ -41,11 +50,21 @@ private:
 	Camera3D m_camera{ glm::vec3{ 0.0f, 48.0f, 0.0f } };
 	glm::mat4 m_perspectiveMatrix{ 1.0f };
 	glm::mat4 m_orthogonalMatrix{ 1.0f };
+	float m_elapsedTime = 0.0f;
+
+	std::unique_ptr<UniformBuffer> m_frameUniformBuffer;
 
 	std::unique_ptr<Skybox> m_skybox;
-	std::unique_ptr<Sprite> m_crosshair;
+	std::unique_ptr<SpriteBatch> m_spriteBatch;
 
 	std::unique_ptr<Text> m_selectedBlockText;
+	std::unique_ptr<Text> m_chunkStatisticsText;
+	std::unique_ptr<Text> m_chunkArenaText;
+	std::unique_ptr<Text> m_renderStateText;
+	std::unique_ptr<Text> m_frameStatisticsText;
+	std::unique_ptr<Text> m_renderAllocationText;
+
+	mutable size_t m_lastRenderAllocationCount = 0;
 
 public:
 	explicit VoxelEngine(Game& game);
@@ -57,7 +76,17 @@ public:
 	virtual void PollEvents(const SDL_Event& gameEvent) override;
 	virtual void ProcessInput(const KeyboardState& keyboardState, const MouseState& mouseState, const Sint32 scrollState, const GameControllerState& gameControllerState) override;
 	virtual void Update(const float deltaTime) override;
-	virtual void Render() const override;
+	virtual void LateUpdate() override;
+	virtual void Render(const float interpolation) const override;
+
+private:
+	template <typename... Args>
+	static std::string_view FormatHUDText(std::array<char, s_HUDTextBufferSize>& textBuffer, const char* const format, const Args... arguments)
+	{
+		const int length = std::snprintf(textBuffer.data(), textBuffer.size(), format, arguments...);
+
+		return std::string_view(textBuffer.data(), length > 0 ? std::min(static_cast<size_t>(length), textBuffer.size() - 1u) : 0u);
+	}
 };
 
 #endif
\ No newline at end of file
@@ -0,0 +1,86 @@
+#include "BlockRegistry.h"
+
+BlockRegistry::BlockRegistry(const TileMap& tileMap)
+{
+	constexpr std::array<Direction, s_FaceCount> Directions{ Direction::North, Direction::East, Direction::South, Direction::West, Direction::Zenith, Direction::Nadir };
+
+	for (const Block block : magic_enum::enum_values<Block>())
+	{
+		if (block == Block::Air)
+		{
+			continue;
+		}
+
+		for (const Direction direction : Directions)
+		{
+			m_tileIndices[static_cast<size_t>(block)][GetFaceIndex(direction)] = static_cast<std::uint32_t>(tileMap.GetTileIndex(GetBlockTextureName(block, direction)));
+		}
+	}
+}
+
+std::string_view BlockRegistry::GetBlockTextureName(const Block block, const Direction direction) noexcept
+{
+	switch (block)
+	{
+	case Block::Stone:
+		return "stone";
+
+	case Block::Dirt:
+		return "dirt";
+
+	case Block::Grass:
+		switch (direction)
+		{
+		case Direction::Zenith:
+			return "grass_top";
+
+		case Direction::Nadir:
+			return "dirt";
+
+		default:
+			return "grass_side";
+		}
+
+	case Block::Bedrock:
+		return "bedrock";
+
+	case Block::Log:
+		switch (direction)
+		{
+		case Direction::Zenith:
+		case Direction::Nadir:
+			return "log_top";
+
+		default:
+			return "log_side";
+		}
+
+	case Block::Leaves:
+		return "leaves";
+
+	case Block::Planks:
+		return "planks";
+
+	case Block::Cobblestone:
+		return "cobblestone";
+
+	case Block::Glass:
+		return "glass";
+
+	case Block::Pumpkin:
+		switch (direction)
+		{
+		case Direction::Zenith:
+			return "pumpkin_top";
+
+		case Direction::Nadir:
+			return "pumpkin_bottom";
+
+		default:
+			return "pumpkin_side";
+		}
+	
+	default:
+		return "";
+	}
+}
\ No newline at end of file
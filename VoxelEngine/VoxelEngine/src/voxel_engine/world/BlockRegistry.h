@@ -0,0 +1,61 @@
+#pragma once
+#ifndef BLOCK_REGISTRY_H
+#define BLOCK_REGISTRY_H
+
+#include "../../engine/interfaces/INoncopyable.h"
+
+#include <magic_enum/magic_enum.hpp>
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+
+#include "../../engine/graphics/TileMap.h"
+#include "Block.h"
+
+class BlockRegistry
+	: private INoncopyable
+{
+private:
+	static constexpr size_t s_BlockCount = magic_enum::enum_count<Block>();
+	static constexpr size_t s_FaceCount = 6u;
+
+	std::array<std::array<std::uint32_t, s_FaceCount>, s_BlockCount> m_tileIndices{ };
+
+public:
+	explicit BlockRegistry(const TileMap& tileMap);
+	~BlockRegistry() noexcept = default;
+
+	inline std::uint32_t GetTileIndex(const Block block, const Direction direction) const noexcept { return m_tileIndices[static_cast<size_t>(block)][GetFaceIndex(direction)]; }
+
+private:
+	static constexpr size_t GetFaceIndex(const Direction direction) noexcept
+	{
+		switch (direction)
+		{
+		case Direction::North:
+			return 0u;
+
+		case Direction::East:
+			return 1u;
+
+		case Direction::South:
+			return 2u;
+
+		case Direction::West:
+			return 3u;
+
+		case Direction::Zenith:
+			return 4u;
+
+		case Direction::Nadir:
+		default:
+			return 5u;
+		}
+	}
+
+	static std::string_view GetBlockTextureName(const Block block, const Direction direction) noexcept;
+};
+
+#endif
\ No newline at end of file
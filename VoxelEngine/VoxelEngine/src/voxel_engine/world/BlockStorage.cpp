@@ -0,0 +1,244 @@
+#include "BlockStorage.h"
+
+#include <algorithm>
+#include <iterator>
+#include <utility>
+
+BlockStorage::BlockStorage(const size_t size, const Block initialBlock)
+	: m_size(size), m_palette{ initialBlock }, m_paletteCounts{ static_cast<unsigned int>(size) }
+{ }
+
+Block BlockStorage::Get(const size_t index) const noexcept
+{
+	return m_palette[ReadPaletteIndex(index)];
+}
+
+void BlockStorage::Set(const size_t index, const Block block)
+{
+	const size_t oldPaletteIndex = ReadPaletteIndex(index);
+
+	if (m_palette[oldPaletteIndex] == block)
+	{
+		return;
+	}
+
+	const size_t newPaletteIndex = FindOrAddPaletteEntry(block);
+	WritePaletteIndex(index, newPaletteIndex);
+
+	++m_paletteCounts[newPaletteIndex];
+	--m_paletteCounts[oldPaletteIndex];
+
+	if (m_paletteCounts[oldPaletteIndex] == 0)
+	{
+		ShrinkPalette();
+	}
+}
+
+void BlockStorage::Assign(const std::vector<Block>& blocks)
+{
+	m_palette.clear();
+	m_paletteCounts.clear();
+
+	std::vector<size_t> paletteIndices(m_size, 0);
+
+	for (size_t i = 0; i < m_size; ++i)
+	{
+		const auto paletteLocation = std::find(std::cbegin(m_palette), std::cend(m_palette), blocks[i]);
+		const size_t paletteIndex = static_cast<size_t>(std::distance(std::cbegin(m_palette), paletteLocation));
+
+		if (paletteLocation == std::cend(m_palette))
+		{
+			m_palette.push_back(blocks[i]);
+			m_paletteCounts.push_back(0);
+		}
+
+		++m_paletteCounts[paletteIndex];
+		paletteIndices[i] = paletteIndex;
+	}
+
+	m_bitsPerBlock = GetBitsForPaletteSize(m_palette.size());
+	m_data.assign(m_bitsPerBlock == 0 ? 0 : (m_size * m_bitsPerBlock + 63) / 64, 0);
+
+	if (m_bitsPerBlock != 0)
+	{
+		for (size_t i = 0; i < m_size; ++i)
+		{
+			WritePaletteIndex(i, paletteIndices[i]);
+		}
+	}
+
+	m_palette.shrink_to_fit();
+	m_paletteCounts.shrink_to_fit();
+}
+
+std::vector<Block> BlockStorage::ToVector() const
+{
+	if (m_bitsPerBlock == 0)
+	{
+		return std::vector<Block>(m_size, m_palette.front());
+	}
+
+	std::vector<Block> blocks(m_size);
+
+	for (size_t i = 0; i < m_size; ++i)
+	{
+		blocks[i] = m_palette[ReadPaletteIndex(i)];
+	}
+
+	return blocks;
+}
+
+size_t BlockStorage::GetMemoryUsage() const noexcept
+{
+	return sizeof(BlockStorage) + m_palette.capacity() * sizeof(Block) + m_paletteCounts.capacity() * sizeof(unsigned int) + m_data.capacity() * sizeof(std::uint64_t);
+}
+
+unsigned int BlockStorage::GetBitsForPaletteSize(const size_t paletteSize) noexcept
+{
+	if (paletteSize <= 1)
+	{
+		return 0;
+	}
+	else if (paletteSize <= 2)
+	{
+		return 1;
+	}
+	else if (paletteSize <= 4)
+	{
+		return 2;
+	}
+	else if (paletteSize <= 16)
+	{
+		return 4;
+	}
+	else if (paletteSize <= 256)
+	{
+		return 8;
+	}
+	else
+	{
+		return 16;
+	}
+}
+
+size_t BlockStorage::ReadPaletteIndex(const size_t index) const noexcept
+{
+	if (m_bitsPerBlock == 0)
+	{
+		return 0;
+	}
+
+	const size_t bitIndex = index * m_bitsPerBlock;
+	const std::uint64_t mask = (std::uint64_t{ 1 } << m_bitsPerBlock) - 1;
+
+	return static_cast<size_t>((m_data[bitIndex / 64] >> (bitIndex % 64)) & mask);
+}
+
+void BlockStorage::WritePaletteIndex(const size_t index, const size_t paletteIndex) noexcept
+{
+	const size_t bitIndex = index * m_bitsPerBlock;
+	const std::uint64_t mask = (std::uint64_t{ 1 } << m_bitsPerBlock) - 1;
+
+	std::uint64_t& word = m_data[bitIndex / 64];
+	word = (word & ~(mask << (bitIndex % 64))) | ((static_cast<std::uint64_t>(paletteIndex) & mask) << (bitIndex % 64));
+}
+
+size_t BlockStorage::FindOrAddPaletteEntry(const Block block)
+{
+	size_t freePaletteIndex = m_palette.size();
+
+	for (size_t i = 0; i < m_palette.size(); ++i)
+	{
+		if (m_paletteCounts[i] == 0)
+		{
+			freePaletteIndex = std::min(freePaletteIndex, i);
+		}
+		else if (m_palette[i] == block)
+		{
+			return i;
+		}
+	}
+
+	if (freePaletteIndex < m_palette.size())
+	{
+		m_palette[freePaletteIndex] = block;
+
+		return freePaletteIndex;
+	}
+
+	m_palette.push_back(block);
+	m_paletteCounts.push_back(0);
+
+	if (const unsigned int requiredBits = GetBitsForPaletteSize(m_palette.size());
+		requiredBits > m_bitsPerBlock)
+	{
+		std::vector<size_t> paletteRemap(m_palette.size());
+
+		for (size_t i = 0; i < paletteRemap.size(); ++i)
+		{
+			paletteRemap[i] = i;
+		}
+
+		Repack(requiredBits, paletteRemap);
+	}
+
+	return m_palette.size() - 1;
+}
+
+void BlockStorage::Repack(const unsigned int bitsPerBlock, const std::vector<size_t>& paletteRemap)
+{
+	std::vector<size_t> paletteIndices(m_size, 0);
+
+	for (size_t i = 0; i < m_size; ++i)
+	{
+		paletteIndices[i] = paletteRemap[ReadPaletteIndex(i)];
+	}
+
+	m_bitsPerBlock = bitsPerBlock;
+	m_data.assign(m_bitsPerBlock == 0 ? 0 : (m_size * m_bitsPerBlock + 63) / 64, 0);
+	m_data.shrink_to_fit();
+
+	if (m_bitsPerBlock != 0)
+	{
+		for (size_t i = 0; i < m_size; ++i)
+		{
+			WritePaletteIndex(i, paletteIndices[i]);
+		}
+	}
+}
+
+void BlockStorage::ShrinkPalette()
+{
+	const size_t livePaletteSize = static_cast<size_t>(std::count_if(std::cbegin(m_paletteCounts), std::cend(m_paletteCounts), [](const unsigned int count)
+	{
+		return count != 0;
+	}));
+
+	if (GetBitsForPaletteSize(livePaletteSize) >= m_bitsPerBlock)
+	{
+		return;
+	}
+
+	std::vector<size_t> paletteRemap(m_palette.size(), 0);
+	std::vector<Block> livePalette;
+	std::vector<unsigned int> livePaletteCounts;
+
+	livePalette.reserve(livePaletteSize);
+	livePaletteCounts.reserve(livePaletteSize);
+
+	for (size_t i = 0; i < m_palette.size(); ++i)
+	{
+		if (m_paletteCounts[i] != 0)
+		{
+			paletteRemap[i] = livePalette.size();
+
+			livePalette.push_back(m_palette[i]);
+			livePaletteCounts.push_back(m_paletteCounts[i]);
+		}
+	}
+
+	Repack(GetBitsForPaletteSize(livePaletteSize), paletteRemap);
+
+	m_palette = std::move(livePalette);
+	m_paletteCounts = std::move(livePaletteCounts);
+}
\ No newline at end of file
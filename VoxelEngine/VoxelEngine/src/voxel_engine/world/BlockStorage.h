@@ -0,0 +1,48 @@
+#pragma once
+#ifndef BLOCK_STORAGE_H
+#define BLOCK_STORAGE_H
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "Block.h"
+
+class BlockStorage
+{
+private:
+	size_t m_size = 0;
+	unsigned int m_bitsPerBlock = 0;
+
+	std::vector<Block> m_palette;
+	std::vector<unsigned int> m_paletteCounts;
+	std::vector<std::uint64_t> m_data;
+
+public:
+	static constexpr size_t GetFlatMemoryUsage(const size_t size) noexcept { return sizeof(std::vector<Block>) + size * sizeof(Block); }
+
+	explicit BlockStorage(const size_t size, const Block initialBlock = Block::Air);
+	~BlockStorage() noexcept = default;
+
+	Block Get(const size_t index) const noexcept;
+	void Set(const size_t index, const Block block);
+
+	void Assign(const std::vector<Block>& blocks);
+	std::vector<Block> ToVector() const;
+
+	size_t GetMemoryUsage() const noexcept;
+	inline unsigned int GetBitsPerBlock() const noexcept { return m_bitsPerBlock; }
+	inline size_t GetPaletteSize() const noexcept { return m_palette.size(); }
+
+private:
+	static unsigned int GetBitsForPaletteSize(const size_t paletteSize) noexcept;
+
+	size_t ReadPaletteIndex(const size_t index) const noexcept;
+	void WritePaletteIndex(const size_t index, const size_t paletteIndex) noexcept;
+
+	size_t FindOrAddPaletteEntry(const Block block);
+	void Repack(const unsigned int bitsPerBlock, const std::vector<size_t>& paletteRemap);
+	void ShrinkPalette();
+};
+
+#endif
\ No newline at end of file
@@ -1,45 +1,52 @@
 #include "Chunk.h"
 
-#include <glm/gtc/noise.hpp>
-
 #include <array>
+#include <bitset>
+#include <cstdint>
 #include <iterator>
 
 #include "World.h"
 
-Chunk::Chunk(const glm::vec3& position, World& world, const TileMap& tileMap)
-	: Drawable(), m_position(position), m_world(world), m_tileMap(&tileMap)
+const std::array<Chunk::FaceDefinition, 6u> Chunk::s_FaceDefinitions{
+	FaceDefinition{ Direction::West, 0u, 0, 2, 1, { glm::tvec3<std::uint32_t>{ 0u, 0u, 0u }, glm::tvec3<std::uint32_t>{ 0u, 1u, 0u }, glm::tvec3<std::uint32_t>{ 0u, 0u, 1u }, glm::tvec3<std::uint32_t>{ 0u, 1u, 1u } } },
+	FaceDefinition{ Direction::East, 1u, 0, 2, 1, { glm::tvec3<std::uint32_t>{ 1u, 0u, 0u }, glm::tvec3<std::uint32_t>{ 1u, 0u, 1u }, glm::tvec3<std::uint32_t>{ 1u, 1u, 0u }, glm::tvec3<std::uint32_t>{ 1u, 1u, 1u } } },
+	FaceDefinition{ Direction::Nadir, 2u, 1, 0, 2, { glm::tvec3<std::uint32_t>{ 0u, 0u, 0u }, glm::tvec3<std::uint32_t>{ 0u, 0u, 1u }, glm::tvec3<std::uint32_t>{ 1u, 0u, 0u }, glm::tvec3<std::uint32_t>{ 1u, 0u, 1u } } },
+	FaceDefinition{ Direction::Zenith, 3u, 1, 0, 2, { glm::tvec3<std::uint32_t>{ 0u, 1u, 0u }, glm::tvec3<std::uint32_t>{ 1u, 1u, 0u }, glm::tvec3<std::uint32_t>{ 0u, 1u, 1u }, glm::tvec3<std::uint32_t>{ 1u, 1u, 1u } } },
+	FaceDefinition{ Direction::North, 4u, 2, 0, 1, { glm::tvec3<std::uint32_t>{ 0u, 0u, 0u }, glm::tvec3<std::uint32_t>{ 1u, 0u, 0u }, glm::tvec3<std::uint32_t>{ 0u, 1u, 0u }, glm::tvec3<std::uint32_t>{ 1u, 1u, 0u } } },
+	FaceDefinition{ Direction::South, 5u, 2, 0, 1, { glm::tvec3<std::uint32_t>{ 0u, 0u, 1u }, glm::tvec3<std::uint32_t>{ 0u, 1u, 1u }, glm::tvec3<std::uint32_t>{ 1u, 0u, 1u }, glm::tvec3<std::uint32_t>{ 1u, 1u, 1u } } }
+};
+
+Chunk::Chunk(const glm::vec3& position, World& world)
+	: m_position(position), m_world(world)
+{ }
+
+Chunk::~Chunk() noexcept
 {
-	GenerateBlocks();
+	if (m_meshArena != nullptr)
+	{
+		m_meshArena->Free(m_meshAllocation);
+	}
 }
 
-void Chunk::Create()
+void Chunk::GenerateBlocks()
 {
-	m_isReadyToRender = false;
-
-	GenerateMesh();
-	GenerateVertexObjects();
-
-	m_vertices.clear();
-	m_elements.clear();
-	m_isReadyToRender = true;
+	m_structureBlocks.clear();
+	m_blocks.Assign(GenerateTerrain(glm::ivec3(m_position), m_world.GetHeightmapCache(), m_world.GetSeed(), m_structureBlocks));
 }
 
-void Chunk::Render() const
+void Chunk::GenerateStructureBlocks()
 {
-	if (m_isReadyToRender)
-	{
-		glActiveTexture(GL_TEXTURE0);
-		m_tileMap->Bind();
-
-		glBindVertexArray(m_vao);
-		glDrawElements(GL_TRIANGLES, static_cast<GLsizei>(m_elementCount), GL_UNSIGNED_SHORT, nullptr);
-		glBindVertexArray(0);
-	}
+	m_structureBlocks.clear();
+	GenerateTerrain(glm::ivec3(m_position), m_world.GetHeightmapCache(), m_world.GetSeed(), m_structureBlocks);
 }
 
-void Chunk::GenerateBlocks()
+std::vector<Block> Chunk::GenerateTerrain(const glm::ivec3& position, HeightmapCache& heightmapCache, const unsigned int seed, std::vector<StructureBlock>& structureBlocks)
 {
+	const HeightmapCache::Heightmap heightmap = heightmapCache.GetHeightmap(position);
+	CounterRandom random(seed, position / glm::ivec3(s_ChunkSize));
+
+	std::vector<Block> blocks(s_ChunkSize.x * s_ChunkSize.y * s_ChunkSize.z, Block::Air);
+	std::vector<glm::ivec3> treeLocations;
 	size_t currentIndex = 0;
 
 	for (size_t x = 0; x < s_ChunkSize.x; ++x)
@@ -48,38 +55,36 @@ void Chunk::GenerateBlocks()
 		{
 			for (size_t z = 0; z < s_ChunkSize.z; ++z)
 			{
-				unsigned int terrainHeight = static_cast<unsigned int>(glm::ceil(glm::simplex(glm::vec2{ (x + m_position.x + s_seed) / 128.0f, (z + m_position.z + s_seed) / 64.0f }) * 4.0f));
-				terrainHeight += static_cast<unsigned int>(glm::ceil(glm::simplex(glm::vec2{ (x + m_position.x - s_seed) / 64.0f, (z + m_position.z - s_seed) / 128.0f }) * 8.0f + 32.0f));
-
-				const unsigned int currentLayer = static_cast<unsigned int>(y + m_position.y);
+				const unsigned int terrainHeight = heightmap[HeightmapCache::GetHeightIndex(x, z)];
+				const unsigned int currentLayer = static_cast<unsigned int>(y + position.y);
 
 				if (currentLayer == 0)
 				{
-					m_blocks[currentIndex] = Block::Bedrock;
+					blocks[currentIndex] = Block::Bedrock;
 				}
 				else if (currentLayer == terrainHeight)
 				{
-					m_blocks[currentIndex] = Block::Grass;
+					blocks[currentIndex] = Block::Grass;
 				}
 				else if (glm::abs(terrainHeight - currentLayer) <= 3)
 				{
-					m_blocks[currentIndex] = Block::Dirt;
+					blocks[currentIndex] = Block::Dirt;
 				}
 				else if (currentLayer < terrainHeight)
 				{
-					m_blocks[currentIndex] = Block::Stone;
+					blocks[currentIndex] = Block::Stone;
 				}
 				else if (currentLayer == terrainHeight + 1)
 				{
-					const unsigned int generateFoliageNumber = Random::GenerateInt(0, 2500);
+					const unsigned int generateFoliageNumber = random.GenerateInt(0, 2500);
 
 					if (generateFoliageNumber == 0)
 					{
-						m_blocks[currentIndex] = Block::Pumpkin;
+						blocks[currentIndex] = Block::Pumpkin;
 					}
 					else if (generateFoliageNumber < 10)
 					{
-						m_world.AddTreeLocation(static_cast<int>(x + m_position.x), static_cast<int>(y + m_position.y), static_cast<int>(z + m_position.z));
+						treeLocations.emplace_back(x, y, z);
 					}
 				}
 
@@ -87,40 +92,61 @@ void Chunk::GenerateBlocks()
 			}
 		}
 	}
+
+	for (const auto& treeLocation : treeLocations)
+	{
+		PlaceTree(blocks, position, treeLocation, structureBlocks);
+	}
+
+	return blocks;
 }
 
-void Chunk::GenerateMesh()
+void Chunk::LoadBlocks(const std::vector<Block>& blocks, const std::uint32_t appliedStructureSources)
 {
-	const std::vector<unsigned char> blockFaces = GetBlockFaces();
-	GenerateBufferData(blockFaces);
+	m_blocks.Assign(blocks);
+	m_appliedStructureSources = appliedStructureSources;
 }
 
-void Chunk::GenerateVertexObjects() const
+std::vector<Chunk::StructureBlock> Chunk::ExtractStructureBlocks() noexcept
 {
-	glBindVertexArray(m_vao);
+	std::vector<StructureBlock> structureBlocks;
+	std::swap(structureBlocks, m_structureBlocks);
 
-	glBindBuffer(GL_ARRAY_BUFFER, m_vbo);
-	glBufferData(GL_ARRAY_BUFFER, m_vertices.size() * sizeof(Vertex3D), m_vertices.data(), GL_STATIC_DRAW);
+	return structureBlocks;
+}
+
+Chunk::MeshData Chunk::GenerateMesh(const MeshSnapshot& snapshot, const BlockRegistry& blockRegistry, const MeshingMode meshingMode)
+{
+	MeshData meshData;
+	meshData.position = snapshot.position;
+	meshData.revision = snapshot.revision;
 
-	glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, m_ebo);
-	glBufferData(GL_ELEMENT_ARRAY_BUFFER, m_elements.size() * sizeof(unsigned short), m_elements.data(), GL_STATIC_DRAW);
+	size_t faceCount = 0;
+	const std::vector<unsigned char> blockFaces = GetBlockFaces(snapshot, faceCount);
 
-	glEnableVertexAttribArray(Position);
-	glVertexAttribPointer(Position, 3, GL_FLOAT, GL_FALSE, sizeof(Vertex3D), reinterpret_cast<const GLvoid*>(offsetof(Vertex3D, position)));
+	switch (meshingMode)
+	{
+	case MeshingMode::Greedy:
+		GenerateGreedyBufferData(snapshot, blockFaces, faceCount, blockRegistry, meshData);
+
+		break;
 
-	glEnableVertexAttribArray(TextureCoordinates);
-	glVertexAttribPointer(TextureCoordinates, 3, GL_FLOAT, GL_FALSE, sizeof(Vertex3D), reinterpret_cast<const GLvoid*>(offsetof(Vertex3D, textureCoordinates)));
+	case MeshingMode::PerFace:
+	default:
+		GenerateBufferData(snapshot, blockFaces, faceCount, blockRegistry, meshData);
 
-	glBindVertexArray(0);
-	glBindBuffer(GL_ARRAY_BUFFER, 0);
-	glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, 0);
+		break;
+	}
+
+	return meshData;
 }
 
-std::vector<unsigned char> Chunk::GetBlockFaces()
+Chunk::MeshSnapshot Chunk::CreateMeshSnapshot()
 {
-	m_faceCount = 0;
-	std::vector<unsigned char> blockFaces(s_ChunkSize.x * s_ChunkSize.y * s_ChunkSize.z, 0);
-	size_t currentIndex = 0;
+	MeshSnapshot snapshot;
+	snapshot.position = m_position;
+	snapshot.revision = m_meshRevision = ++s_lastMeshRevision;
+	snapshot.blocks = m_blocks.ToVector();
 
 	const std::array<std::optional<Chunk*>, 6u> neighbourChunks{
 		m_world.GetChunkAt(static_cast<int>(m_position.x - s_ChunkSize.x), static_cast<int>(m_position.y), static_cast<int>(m_position.z)),
@@ -131,56 +157,145 @@ std::vector<unsigned char> Chunk::GetBlockFaces()
 		m_world.GetChunkAt(static_cast<int>(m_position.x), static_cast<int>(m_position.y), static_cast<int>(m_position.z + s_ChunkSize.z))
 	};
 
+	constexpr std::array<Direction, 6u> FacingBorders{ Direction::East, Direction::West, Direction::Zenith, Direction::Nadir, Direction::South, Direction::North };
+
+	for (size_t i = 0; i < neighbourChunks.size(); ++i)
+	{
+		if (neighbourChunks[i].has_value())
+		{
+			snapshot.neighbourSlices[i] = neighbourChunks[i].value()->GetBorderSlice(FacingBorders[i]);
+		}
+	}
+
+	return snapshot;
+}
+
+void Chunk::UploadMesh(const MeshData& meshData, ChunkMeshArena& meshArena)
+{
+	if (meshData.revision != m_meshRevision)
+	{
+		return;
+	}
+
+	if (m_meshArena != nullptr)
+	{
+		m_meshArena->Free(m_meshAllocation);
+	}
+
+	m_meshArena = &meshArena;
+	m_meshAllocation = m_meshArena->Allocate(meshData.vertices);
+
+	m_vertexCount = meshData.vertices.size();
+	m_elementCount = QuadElementBuffer::GetElementCount(meshData.vertices.size() / 4u);
+	m_isReadyToRender = true;
+}
+
+std::vector<unsigned char> Chunk::GetBlockFaces(const MeshSnapshot& snapshot, size_t& faceCount)
+{
+	static_assert(s_ChunkSize.z + 2 <= std::numeric_limits<std::uint32_t>::digits, "Chunk rows must fit into a padded 32-bit mask.");
+
+	constexpr size_t PaddedSizeX = s_ChunkSize.x + 2;
+	constexpr size_t PaddedSizeY = s_ChunkSize.y + 2;
+	constexpr std::uint32_t RowMask = (std::uint32_t{ 1 } << s_ChunkSize.z) - 1;
+
+	std::vector<std::uint32_t> opaqueRows(PaddedSizeX * PaddedSizeY, 0);
+	std::vector<std::uint32_t> solidRows(s_ChunkSize.x * s_ChunkSize.y, 0);
+
+	const auto getOpaqueRow = [&opaqueRows](const size_t paddedX, const size_t paddedY) -> std::uint32_t&
+	{
+		return opaqueRows[paddedX * PaddedSizeY + paddedY];
+	};
+
+	size_t currentIndex = 0;
+
 	for (size_t x = 0; x < s_ChunkSize.x; ++x)
 	{
 		for (size_t y = 0; y < s_ChunkSize.y; ++y)
 		{
+			std::uint32_t solidRow = 0;
+			std::uint32_t opaqueRow = 0;
+
 			for (size_t z = 0; z < s_ChunkSize.z; ++z)
 			{
-				if (m_blocks[currentIndex] == Block::Air)
-				{
-					++currentIndex;
+				const Block block = snapshot.blocks[currentIndex++];
 
-					continue;
-				}
+				solidRow |= static_cast<std::uint32_t>(block != Block::Air) << z;
+				opaqueRow |= static_cast<std::uint32_t>(!IsTransparent(block)) << (z + 1);
+			}
 
-				if ((x == 0 && (!neighbourChunks[0].has_value() || (neighbourChunks[0].has_value() && IsTransparent(neighbourChunks[0].value()->GetBlockAt(s_ChunkSize.x - 1, y, z)))) || (x != 0 && IsTransparent(GetBlockAt(x - 1, y, z)))))
-				{
-					blockFaces[currentIndex] |= Direction::West;
-					++m_faceCount;
-				}
+			solidRows[x * s_ChunkSize.y + y] = solidRow;
+			getOpaqueRow(x + 1, y + 1) = opaqueRow;
+		}
+	}
 
-				if ((x == s_ChunkSize.x - 1 && (!neighbourChunks[1].has_value() || (neighbourChunks[1].has_value() && IsTransparent(neighbourChunks[1].value()->GetBlockAt(0, y, z)))) || (x != s_ChunkSize.x - 1 && IsTransparent(GetBlockAt(x + 1, y, z)))))
-				{
-					blockFaces[currentIndex] |= Direction::East;
-					++m_faceCount;
-				}
+	const auto isNeighbourOpaque = [&snapshot](const size_t neighbourIndex, const size_t sliceIndex) -> std::uint32_t
+	{
+		return !snapshot.neighbourSlices[neighbourIndex].empty() && !IsTransparent(snapshot.neighbourSlices[neighbourIndex][sliceIndex]);
+	};
 
-				if ((y == 0 && (!neighbourChunks[2].has_value() || (neighbourChunks[2].has_value() && IsTransparent(neighbourChunks[2].value()->GetBlockAt(x, s_ChunkSize.y - 1, z))))) || (y != 0 && IsTransparent(GetBlockAt(x, y - 1, z))))
-				{
-					blockFaces[currentIndex] |= Direction::Nadir;
-					++m_faceCount;
-				}
+	for (size_t y = 0; y < s_ChunkSize.y; ++y)
+	{
+		for (size_t z = 0; z < s_ChunkSize.z; ++z)
+		{
+			getOpaqueRow(0, y + 1) |= isNeighbourOpaque(0, y * s_ChunkSize.z + z) << (z + 1);
+			getOpaqueRow(PaddedSizeX - 1, y + 1) |= isNeighbourOpaque(1, y * s_ChunkSize.z + z) << (z + 1);
+		}
+	}
 
-				if ((y == s_ChunkSize.y - 1 && (!neighbourChunks[3].has_value() || (neighbourChunks[3].has_value() && IsTransparent(neighbourChunks[3].value()->GetBlockAt(x, 0, z))))) || (y != s_ChunkSize.y - 1 && IsTransparent(GetBlockAt(x, y + 1, z))))
-				{
-					blockFaces[currentIndex] |= Direction::Zenith;
-					++m_faceCount;
-				}
+	for (size_t x = 0; x < s_ChunkSize.x; ++x)
+	{
+		for (size_t z = 0; z < s_ChunkSize.z; ++z)
+		{
+			getOpaqueRow(x + 1, 0) |= isNeighbourOpaque(2, x * s_ChunkSize.z + z) << (z + 1);
+			getOpaqueRow(x + 1, PaddedSizeY - 1) |= isNeighbourOpaque(3, x * s_ChunkSize.z + z) << (z + 1);
+		}
 
-				if ((z == 0 && (!neighbourChunks[4].has_value() || (neighbourChunks[4].has_value() && IsTransparent(neighbourChunks[4].value()->GetBlockAt(x, y, s_ChunkSize.z - 1)))) || (z != 0 && IsTransparent(GetBlockAt(x, y, z - 1)))))
-				{
-					blockFaces[currentIndex] |= Direction::North;
-					++m_faceCount;
-				}
+		for (size_t y = 0; y < s_ChunkSize.y; ++y)
+		{
+			getOpaqueRow(x + 1, y + 1) |= isNeighbourOpaque(4, x * s_ChunkSize.y + y);
+			getOpaqueRow(x + 1, y + 1) |= isNeighbourOpaque(5, x * s_ChunkSize.y + y) << (s_ChunkSize.z + 1);
+		}
+	}
 
-				if ((z == s_ChunkSize.z - 1 && (!neighbourChunks[5].has_value() || (neighbourChunks[5].has_value() && IsTransparent(neighbourChunks[5].value()->GetBlockAt(x, y, 0)))) || (z != s_ChunkSize.z - 1 && IsTransparent(GetBlockAt(x, y, z + 1)))))
-				{
-					blockFaces[currentIndex] |= Direction::South;
-					++m_faceCount;
-				}
+	faceCount = 0;
+	std::vector<unsigned char> blockFaces(s_ChunkSize.x * s_ChunkSize.y * s_ChunkSize.z, 0);
+	currentIndex = 0;
 
-				++currentIndex;
+	for (size_t x = 0; x < s_ChunkSize.x; ++x)
+	{
+		for (size_t y = 0; y < s_ChunkSize.y; ++y)
+		{
+			const std::uint32_t solidRow = solidRows[x * s_ChunkSize.y + y];
+
+			if (solidRow == 0)
+			{
+				currentIndex += s_ChunkSize.z;
+
+				continue;
+			}
+
+			const std::uint32_t centreRow = getOpaqueRow(x + 1, y + 1);
+
+			const std::uint32_t westFaces = solidRow & ~(getOpaqueRow(x, y + 1) >> 1) & RowMask;
+			const std::uint32_t eastFaces = solidRow & ~(getOpaqueRow(x + 2, y + 1) >> 1) & RowMask;
+			const std::uint32_t nadirFaces = solidRow & ~(getOpaqueRow(x + 1, y) >> 1) & RowMask;
+			const std::uint32_t zenithFaces = solidRow & ~(getOpaqueRow(x + 1, y + 2) >> 1) & RowMask;
+			const std::uint32_t northFaces = solidRow & ~centreRow & RowMask;
+			const std::uint32_t southFaces = solidRow & ~(centreRow >> 2) & RowMask;
+
+			faceCount += std::bitset<32>(westFaces).count() + std::bitset<32>(eastFaces).count() + std::bitset<32>(nadirFaces).count() +
+				std::bitset<32>(zenithFaces).count() + std::bitset<32>(northFaces).count() + std::bitset<32>(southFaces).count();
+
+			for (size_t z = 0; z < s_ChunkSize.z; ++z)
+			{
+				blockFaces[currentIndex++] = static_cast<unsigned char>(
+					(((westFaces >> z) & 1u) * Direction::West) |
+					(((eastFaces >> z) & 1u) * Direction::East) |
+					(((nadirFaces >> z) & 1u) * Direction::Nadir) |
+					(((zenithFaces >> z) & 1u) * Direction::Zenith) |
+					(((northFaces >> z) & 1u) * Direction::North) |
+					(((southFaces >> z) & 1u) * Direction::South)
+				);
 			}
 		}
 	}
@@ -188,13 +303,10 @@ std::vector<unsigned char> Chunk::GetBlockFaces()
 	return blockFaces;
 }
 
-void Chunk::GenerateBufferData(const std::vector<unsigned char>& blockFaces)
+void Chunk::GenerateBufferData(const MeshSnapshot& snapshot, const std::vector<unsigned char>& blockFaces, const size_t faceCount, const BlockRegistry& blockRegistry, MeshData& meshData)
 {
-	m_vertices.resize(m_faceCount * 4);
-	m_elements.resize(m_faceCount * 6);
+	meshData.vertices.reserve(faceCount * 4);
 
-	unsigned int vertexIndex = 0;
-	unsigned int elementIndex = 0;
 	size_t currentIndex = 0;
 
 	for (size_t x = 0; x < s_ChunkSize.x; ++x)
@@ -210,166 +322,241 @@ void Chunk::GenerateBufferData(const std::vector<unsigned char>& blockFaces)
 					continue;
 				}
 
-				if (blockFaces[currentIndex] & Direction::West)
+				for (const auto& face : s_FaceDefinitions)
 				{
-					const float tileIndex = static_cast<float>(m_tileMap->GetTileIndex(GetBlockTextureName(GetBlockAt(x, y, z), Direction::West)));
-
-					m_vertices[static_cast<size_t>(vertexIndex) + 0] = Vertex3D{ glm::vec3{ x + m_position.x, y + m_position.y, z + m_position.z }, glm::vec3{ 0.0f, 0.0f, tileIndex } };
-					m_vertices[static_cast<size_t>(vertexIndex) + 1] = Vertex3D{ glm::vec3{ x + m_position.x, y + m_position.y + 1, z + m_position.z }, glm::vec3{ 0.0f, 1.0f, tileIndex } };
-					m_vertices[static_cast<size_t>(vertexIndex) + 2] = Vertex3D{ glm::vec3{ x + m_position.x, y + m_position.y, z + m_position.z + 1 }, glm::vec3{ 1.0f, 0.0f, tileIndex } };
-					m_vertices[static_cast<size_t>(vertexIndex) + 3] = Vertex3D{ glm::vec3{ x + m_position.x, y + m_position.y + 1, z + m_position.z + 1 }, glm::vec3{ 1.0f, 1.0f, tileIndex } };
+					if (blockFaces[currentIndex] & face.direction)
+					{
+						const std::uint32_t tileIndex = blockRegistry.GetTileIndex(snapshot.blocks[currentIndex], face.direction);
 
-					AddElements(elementIndex, vertexIndex);
-					vertexIndex += 4;
+						AddFace(meshData, face, glm::tvec3<std::uint32_t>{ x, y, z }, glm::tvec3<std::uint32_t>{ 1u, 1u, 1u }, tileIndex);
+					}
 				}
 
-				if (blockFaces[currentIndex] & Direction::East)
-				{
-					const float tileIndex = static_cast<float>(m_tileMap->GetTileIndex(GetBlockTextureName(GetBlockAt(x, y, z), Direction::East)));
+				++currentIndex;
+			}
+		}
+	}
+}
+
+void Chunk::GenerateGreedyBufferData(const MeshSnapshot& snapshot, const std::vector<unsigned char>& blockFaces, const size_t faceCount, const BlockRegistry& blockRegistry, MeshData& meshData)
+{
+	meshData.vertices.reserve(faceCount * 4);
 
-					m_vertices[static_cast<size_t>(vertexIndex) + 0] = Vertex3D{ glm::vec3{ x + m_position.x + 1, y + m_position.y, z + m_position.z }, glm::vec3{ 1.0f, 0.0f, tileIndex } };
-					m_vertices[static_cast<size_t>(vertexIndex) + 1] = Vertex3D{ glm::vec3{ x + m_position.x + 1, y + m_position.y, z + m_position.z + 1 }, glm::vec3{ 0.0f, 0.0f, tileIndex } };
-					m_vertices[static_cast<size_t>(vertexIndex) + 2] = Vertex3D{ glm::vec3{ x + m_position.x + 1, y + m_position.y + 1, z + m_position.z }, glm::vec3{ 1.0f, 1.0f, tileIndex } };
-					m_vertices[static_cast<size_t>(vertexIndex) + 3] = Vertex3D{ glm::vec3{ x + m_position.x + 1, y + m_position.y + 1, z + m_position.z + 1 }, glm::vec3{ 0.0f, 1.0f, tileIndex } };
+	constexpr int NoFace = -1;
+	std::vector<int> tileMask;
 
-					AddElements(elementIndex, vertexIndex);
-					vertexIndex += 4;
-				}
+	for (const auto& face : s_FaceDefinitions)
+	{
+		const size_t uSize = s_ChunkSize[face.uAxis];
+		const size_t vSize = s_ChunkSize[face.vAxis];
 
-				if (blockFaces[currentIndex] & Direction::Nadir)
+		for (size_t slice = 0; slice < s_ChunkSize[face.normalAxis]; ++slice)
+		{
+			tileMask.assign(uSize * vSize, NoFace);
+
+			for (size_t v = 0; v < vSize; ++v)
+			{
+				for (size_t u = 0; u < uSize; ++u)
 				{
-					const float tileIndex = static_cast<float>(m_tileMap->GetTileIndex(GetBlockTextureName(GetBlockAt(x, y, z), Direction::Nadir)));
+					glm::tvec3<size_t> blockPosition{ 0u, 0u, 0u };
+					blockPosition[face.normalAxis] = slice;
+					blockPosition[face.uAxis] = u;
+					blockPosition[face.vAxis] = v;
 
-					m_vertices[static_cast<size_t>(vertexIndex) + 0] = Vertex3D{ glm::vec3{ x + m_position.x, y + m_position.y, z + m_position.z }, glm::vec3{ 0.0f, 0.0f, tileIndex } };
-					m_vertices[static_cast<size_t>(vertexIndex) + 1] = Vertex3D{ glm::vec3{ x + m_position.x, y + m_position.y, z + m_position.z + 1 }, glm::vec3{ 0.0f, 1.0f, tileIndex } };
-					m_vertices[static_cast<size_t>(vertexIndex) + 2] = Vertex3D{ glm::vec3{ x + m_position.x + 1, y + m_position.y, z + m_position.z }, glm::vec3{ 1.0f, 0.0f, tileIndex } };
-					m_vertices[static_cast<size_t>(vertexIndex) + 3] = Vertex3D{ glm::vec3{ x + m_position.x + 1, y + m_position.y, z + m_position.z + 1 }, glm::vec3{ 1.0f, 1.0f, tileIndex } };
+					const size_t blockIndex = GetBlockIndex(blockPosition.x, blockPosition.y, blockPosition.z);
 
-					AddElements(elementIndex, vertexIndex);
-					vertexIndex += 4;
+					if (blockFaces[blockIndex] & face.direction)
+					{
+						tileMask[v * uSize + u] = static_cast<int>(blockRegistry.GetTileIndex(snapshot.blocks[blockIndex], face.direction));
+					}
 				}
+			}
 
-				if (blockFaces[currentIndex] & Direction::Zenith)
+			for (size_t v = 0; v < vSize; ++v)
+			{
+				for (size_t u = 0; u < uSize; ++u)
 				{
-					const float tileIndex = static_cast<float>(m_tileMap->GetTileIndex(GetBlockTextureName(GetBlockAt(x, y, z), Direction::Zenith)));
+					const int tileIndex = tileMask[v * uSize + u];
 
-					m_vertices[static_cast<size_t>(vertexIndex) + 0] = Vertex3D{ glm::vec3{ x + m_position.x, y + m_position.y + 1, z + m_position.z }, glm::vec3{ 0.0f, 0.0f, tileIndex } };
-					m_vertices[static_cast<size_t>(vertexIndex) + 1] = Vertex3D{ glm::vec3{ x + m_position.x + 1, y + m_position.y + 1, z + m_position.z }, glm::vec3{ 1.0f, 0.0f, tileIndex } };
-					m_vertices[static_cast<size_t>(vertexIndex) + 2] = Vertex3D{ glm::vec3{ x + m_position.x, y + m_position.y + 1, z + m_position.z + 1 }, glm::vec3{ 0.0f, 1.0f, tileIndex } };
-					m_vertices[static_cast<size_t>(vertexIndex) + 3] = Vertex3D{ glm::vec3{ x + m_position.x + 1, y + m_position.y + 1, z + m_position.z + 1 }, glm::vec3{ 1.0f, 1.0f, tileIndex } };
+					if (tileIndex == NoFace)
+					{
+						continue;
+					}
 
-					AddElements(elementIndex, vertexIndex);
-					vertexIndex += 4;
-				}
+					size_t width = 1;
 
-				if (blockFaces[currentIndex] & Direction::North)
-				{
-					const float tileIndex = static_cast<float>(m_tileMap->GetTileIndex(GetBlockTextureName(GetBlockAt(x, y, z), Direction::North)));
-				
-					m_vertices[static_cast<size_t>(vertexIndex) + 0] = Vertex3D{ glm::vec3{ x + m_position.x, y + m_position.y, z + m_position.z }, glm::vec3{ 1.0f, 0.0f, tileIndex } };
-					m_vertices[static_cast<size_t>(vertexIndex) + 1] = Vertex3D{ glm::vec3{ x + m_position.x + 1, y + m_position.y, z + m_position.z }, glm::vec3{ 0.0f, 0.0f, tileIndex } };
-					m_vertices[static_cast<size_t>(vertexIndex) + 2] = Vertex3D{ glm::vec3{ x + m_position.x, y + m_position.y + 1, z + m_position.z }, glm::vec3{ 1.0f, 1.0f, tileIndex } };
-					m_vertices[static_cast<size_t>(vertexIndex) + 3] = Vertex3D{ glm::vec3{ x + m_position.x + 1, y + m_position.y + 1, z + m_position.z }, glm::vec3{ 0.0f, 1.0f, tileIndex } };
-				
-					AddElements(elementIndex, vertexIndex);
-					vertexIndex += 4;
-				}
+					while (u + width < uSize && tileMask[v * uSize + u + width] == tileIndex)
+					{
+						++width;
+					}
 
-				if (blockFaces[currentIndex] & Direction::South)
-				{
-					const float tileIndex = static_cast<float>(m_tileMap->GetTileIndex(GetBlockTextureName(GetBlockAt(x, y, z), Direction::South)));
-					
-					m_vertices[static_cast<size_t>(vertexIndex) + 0] = Vertex3D{ glm::vec3{ x + m_position.x, y + m_position.y, z + m_position.z + 1 }, glm::vec3{ 0.0f, 0.0f, tileIndex } };
-					m_vertices[static_cast<size_t>(vertexIndex) + 1] = Vertex3D{ glm::vec3{ x + m_position.x, y + m_position.y + 1, z + m_position.z + 1 }, glm::vec3{ 0.0f, 1.0f, tileIndex } };
-					m_vertices[static_cast<size_t>(vertexIndex) + 2] = Vertex3D{ glm::vec3{ x + m_position.x + 1, y + m_position.y, z + m_position.z + 1 }, glm::vec3{ 1.0f, 0.0f, tileIndex } };
-					m_vertices[static_cast<size_t>(vertexIndex) + 3] = Vertex3D{ glm::vec3{ x + m_position.x + 1, y + m_position.y + 1, z + m_position.z + 1 }, glm::vec3{ 1.0f, 1.0f, tileIndex } };
-
-					AddElements(elementIndex, vertexIndex);
-					vertexIndex += 4;
-				}
+					size_t height = 1;
+					bool canExtend = true;
 
-				++currentIndex;
+					while (v + height < vSize && canExtend)
+					{
+						for (size_t i = 0; i < width; ++i)
+						{
+							if (tileMask[(v + height) * uSize + u + i] != tileIndex)
+							{
+								canExtend = false;
+
+								break;
+							}
+						}
+
+						if (canExtend)
+						{
+							++height;
+						}
+					}
+
+					for (size_t j = 0; j < height; ++j)
+					{
+						for (size_t i = 0; i < width; ++i)
+						{
+							tileMask[(v + j) * uSize + u + i] = NoFace;
+						}
+					}
+
+					glm::tvec3<std::uint32_t> origin{ 0u, 0u, 0u };
+					origin[face.normalAxis] = static_cast<std::uint32_t>(slice);
+					origin[face.uAxis] = static_cast<std::uint32_t>(u);
+					origin[face.vAxis] = static_cast<std::uint32_t>(v);
+
+					glm::tvec3<std::uint32_t> extent{ 1u, 1u, 1u };
+					extent[face.uAxis] = static_cast<std::uint32_t>(width);
+					extent[face.vAxis] = static_cast<std::uint32_t>(height);
+
+					AddFace(meshData, face, origin, extent, static_cast<std::uint32_t>(tileIndex));
+				}
 			}
 		}
 	}
+}
 
-	m_elementCount = m_elements.size();
+void Chunk::AddFace(MeshData& meshData, const FaceDefinition& face, const glm::tvec3<std::uint32_t>& origin, const glm::tvec3<std::uint32_t>& extent, const std::uint32_t tileIndex)
+{
+	for (const auto& corner : face.corners)
+	{
+		meshData.vertices.push_back(PackVertex(origin + corner * extent, face.normalIndex, tileIndex));
+	}
 }
 
-void Chunk::AddElements(unsigned int& elementIndex, const unsigned int vertexIndex)
+std::uint32_t Chunk::PackVertex(const glm::tvec3<std::uint32_t>& position, const std::uint32_t normalIndex, const std::uint32_t tileIndex) noexcept
 {
-	m_elements[elementIndex++] = vertexIndex + 0;
-	m_elements[elementIndex++] = vertexIndex + 2;
-	m_elements[elementIndex++] = vertexIndex + 1;
+	static_assert(s_ChunkSize.x < (1u << s_PackedPositionBits) && s_ChunkSize.y < (1u << s_PackedPositionBits) && s_ChunkSize.z < (1u << s_PackedPositionBits), "Chunk corners must fit into the packed position bits.");
 
-	m_elements[elementIndex++] = vertexIndex + 2;
-	m_elements[elementIndex++] = vertexIndex + 3;
-	m_elements[elementIndex++] = vertexIndex + 1;
+	return position.x | (position.y << s_PackedPositionBits) | (position.z << (s_PackedPositionBits * 2u)) | (normalIndex << s_PackedNormalOffset) | (tileIndex << s_PackedTileOffset);
 }
 
-std::string Chunk::GetBlockTextureName(const Block block, const Direction direction) const
+void Chunk::PlaceTree(std::vector<Block>& blocks, const glm::ivec3& position, const glm::ivec3& location, std::vector<StructureBlock>& structureBlocks)
 {
-	switch (block)
+	constexpr int TreeHeight = 6;
+
+	for (int i = 0; i < TreeHeight; ++i)
 	{
-	case Block::Stone:
-		return "stone";
+		PlaceStructureBlock(blocks, position, location + glm::ivec3{ 0, i, 0 }, Block::Log, structureBlocks);
+	}
 
-	case Block::Dirt:
-		return "dirt";
+	constexpr int MinLeafHeight = 4;
+	constexpr int MaxLeafHeight = 8;
 
-	case Block::Grass:
-		switch (direction)
-		{
-		case Direction::Zenith:
-			return "grass_top";
+	int leafRadius = 3;
 
-		case Direction::Nadir:
-			return "dirt";
+	for (int i = MinLeafHeight; i <= MaxLeafHeight; ++i)
+	{
+		for (int j = -leafRadius; j <= leafRadius; ++j)
+		{
+			for (int k = -leafRadius; k <= leafRadius; ++k)
+			{
+				PlaceStructureBlock(blocks, position, location + glm::ivec3{ j, i, k }, Block::Leaves, structureBlocks);
+			}
+		}
 
-		default:
-			return "grass_side";
+		if (i == MinLeafHeight + 1 || i == MinLeafHeight + 3)
+		{
+			--leafRadius;
 		}
+	}
+}
 
-	case Block::Bedrock:
-		return "bedrock";
+void Chunk::PlaceStructureBlock(std::vector<Block>& blocks, const glm::ivec3& position, const glm::ivec3& localPosition, const Block block, std::vector<StructureBlock>& structureBlocks)
+{
+	if (glm::any(glm::lessThan(localPosition, glm::ivec3{ 0, 0, 0 })) || glm::any(glm::greaterThanEqual(localPosition, glm::ivec3(s_ChunkSize))))
+	{
+		structureBlocks.push_back(StructureBlock{ localPosition + position, block });
 
-	case Block::Log:
-		switch (direction)
-		{
-		case Direction::Zenith:
-		case Direction::Nadir:
-			return "log_top";
+		return;
+	}
 
-		default:
-			return "log_side";
-		}
+	if (Block& currentBlock = blocks[GetBlockIndex(localPosition.x, localPosition.y, localPosition.z)];
+		CanPlaceStructureBlock(currentBlock, block))
+	{
+		currentBlock = block;
+	}
+}
+
+std::vector<Block> Chunk::GetBorderSlice(const Direction direction) const
+{
+	std::vector<Block> slice;
 
-	case Block::Leaves:
-		return "leaves";
+	switch (direction)
+	{
+	case Direction::West:
+	case Direction::East:
+	{
+		const size_t x = direction == Direction::West ? 0 : s_ChunkSize.x - 1;
+		slice.reserve(s_ChunkSize.y * s_ChunkSize.z);
 
-	case Block::Planks:
-		return "planks";
+		for (size_t y = 0; y < s_ChunkSize.y; ++y)
+		{
+			for (size_t z = 0; z < s_ChunkSize.z; ++z)
+			{
+				slice.push_back(GetBlockAt(x, y, z));
+			}
+		}
 
-	case Block::Cobblestone:
-		return "cobblestone";
+		break;
+	}
 
-	case Block::Glass:
-		return "glass";
+	case Direction::Nadir:
+	case Direction::Zenith:
+	{
+		const size_t y = direction == Direction::Nadir ? 0 : s_ChunkSize.y - 1;
+		slice.reserve(s_ChunkSize.x * s_ChunkSize.z);
 
-	case Block::Pumpkin:
-		switch (direction)
+		for (size_t x = 0; x < s_ChunkSize.x; ++x)
 		{
-		case Direction::Zenith:
-			return "pumpkin_top";
+			for (size_t z = 0; z < s_ChunkSize.z; ++z)
+			{
+				slice.push_back(GetBlockAt(x, y, z));
+			}
+		}
+
+		break;
+	}
 
-		case Direction::Nadir:
-			return "pumpkin_bottom";
+	case Direction::North:
+	case Direction::South:
+	{
+		const size_t z = direction == Direction::North ? 0 : s_ChunkSize.z - 1;
+		slice.reserve(s_ChunkSize.x * s_ChunkSize.y);
 
-		default:
-			return "pumpkin_side";
+		for (size_t x = 0; x < s_ChunkSize.x; ++x)
+		{
+			for (size_t y = 0; y < s_ChunkSize.y; ++y)
+			{
+				slice.push_back(GetBlockAt(x, y, z));
+			}
 		}
-	
+
+		break;
+	}
+
 	default:
-		return "";
+		break;
 	}
+
+	return slice;
 }
\ No newline at end of file
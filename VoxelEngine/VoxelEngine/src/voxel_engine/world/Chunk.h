@@ -2,67 +2,148 @@
 #ifndef CHUNK_H
 #define CHUNK_H
 
-#include "../../engine/graphics/Drawable.h"
+#include "../../engine/interfaces/INoncopyable.h"
+#include "../../engine/interfaces/INonmovable.h"
 
 #include <glm/glm.hpp>
 
+#include <array>
 #include <cstddef>
+#include <cstdint>
 #include <limits>
-#include <string>
 #include <vector>
 
-#include "../../engine/interfaces/INonmovable.h"
-
-#include "../../engine/graphics/TileMap.h"
-#include "../../engine/graphics/Vertex.h"
-#include "../../engine/utility/Random.h"
+#include "../../engine/utility/CounterRandom.h"
 #include "Block.h"
+#include "BlockRegistry.h"
+#include "BlockStorage.h"
+#include "ChunkMeshArena.h"
 
+class HeightmapCache;
 class World;
 
 class Chunk
-	: public Drawable, private INonmovable
+	: private INoncopyable, private INonmovable
 {
+public:
+	enum class MeshingMode
+	{
+		PerFace,
+		Greedy
+	};
+
+	struct MeshSnapshot
+	{
+		glm::vec3 position{ 0.0f, 0.0f, 0.0f };
+		unsigned int revision = 0;
+
+		std::vector<Block> blocks;
+		std::array<std::vector<Block>, 6u> neighbourSlices;
+	};
+
+	struct StructureBlock
+	{
+		glm::ivec3 position{ 0, 0, 0 };
+		Block block = Block::Air;
+	};
+
+	struct MeshData
+	{
+		glm::vec3 position{ 0.0f, 0.0f, 0.0f };
+		unsigned int revision = 0;
+
+		std::vector<std::uint32_t> vertices;
+	};
+
 private:
+	struct FaceDefinition
+	{
+		Direction direction;
+		std::uint32_t normalIndex;
+
+		glm::length_t normalAxis;
+		glm::length_t uAxis;
+		glm::length_t vAxis;
+
+		std::array<glm::tvec3<std::uint32_t>, 4u> corners;
+	};
+
 	static constexpr glm::tvec3<size_t> s_ChunkSize{ 16u, 16u, 16u };
-	inline static const unsigned int s_seed = Random::GenerateInt(0u, static_cast<unsigned int>(std::numeric_limits<unsigned short>::max()));
+
+	static constexpr std::uint32_t s_PackedPositionBits = 5u;
+	static constexpr std::uint32_t s_PackedNormalBits = 3u;
+	static constexpr std::uint32_t s_PackedNormalOffset = s_PackedPositionBits * 3u;
+	static constexpr std::uint32_t s_PackedTileOffset = s_PackedNormalOffset + s_PackedNormalBits;
+
+	static const std::array<FaceDefinition, 6u> s_FaceDefinitions;
+
+	inline static unsigned int s_lastMeshRevision = 0;
 
 	glm::vec3 m_position{ 0.0f, 0.0f, 0.0f };
-	std::vector<Block> m_blocks{ s_ChunkSize.x * s_ChunkSize.y * s_ChunkSize.z, Block::Air };
+	BlockStorage m_blocks{ s_ChunkSize.x * s_ChunkSize.y * s_ChunkSize.z, Block::Air };
+	std::vector<StructureBlock> m_structureBlocks;
+	std::uint32_t m_appliedStructureSources = 0u;
 
 	World& m_world;
-	const TileMap* m_tileMap = nullptr;
 
-	size_t m_faceCount = 0;
+	ChunkMeshArena* m_meshArena = nullptr;
+	ChunkMeshArena::Allocation m_meshAllocation;
+
+	size_t m_vertexCount = 0;
 	size_t m_elementCount = 0;
-	
-	std::vector<Vertex3D> m_vertices;
-	std::vector<unsigned short> m_elements;
+	unsigned int m_meshRevision = 0;
 
 	bool m_isReadyToRender = false;
+	bool m_isModified = false;
 
 public:
 	static constexpr glm::tvec3<size_t> GetSize() noexcept { return s_ChunkSize; }
+	static constexpr size_t GetMaxFaceCount() noexcept { return s_ChunkSize.x * s_ChunkSize.y * s_ChunkSize.z * 6u; }
+	static MeshData GenerateMesh(const MeshSnapshot& snapshot, const BlockRegistry& blockRegistry, const MeshingMode meshingMode);
+	static std::vector<unsigned char> GetBlockFaces(const MeshSnapshot& snapshot, size_t& faceCount);
+	static constexpr bool CanPlaceStructureBlock(const Block currentBlock, const Block block) noexcept { return currentBlock == Block::Air || (currentBlock == Block::Leaves && block == Block::Log); }
+	static std::vector<Block> GenerateTerrain(const glm::ivec3& position, HeightmapCache& heightmapCache, const unsigned int seed, std::vector<StructureBlock>& structureBlocks);
 
-	Chunk(const glm::vec3& position, World& world, const TileMap& tileMap);
-	virtual ~Chunk() noexcept override = default;
+	Chunk(const glm::vec3& position, World& world);
+	~Chunk() noexcept;
 
-	void Create();
-	void Render() const;
-
-	inline Block GetBlockAt(const size_t x, const size_t y, const size_t z) const noexcept { return m_blocks[x * s_ChunkSize.y * s_ChunkSize.z + y * s_ChunkSize.z + z]; }
-	inline void SetBlockAt(const size_t x, const size_t y, const size_t z, const Block block) noexcept { m_blocks[x * s_ChunkSize.y * s_ChunkSize.z + y * s_ChunkSize.z + z] = block; }
+	void GenerateBlocks();
+	void GenerateStructureBlocks();
+	void LoadBlocks(const std::vector<Block>& blocks, const std::uint32_t appliedStructureSources);
+	std::vector<StructureBlock> ExtractStructureBlocks() noexcept;
+	MeshSnapshot CreateMeshSnapshot();
+	void UploadMesh(const MeshData& meshData, ChunkMeshArena& meshArena);
+
+	inline Block GetBlockAt(const size_t x, const size_t y, const size_t z) const noexcept { return m_blocks.Get(GetBlockIndex(x, y, z)); }
+	inline void SetBlockAt(const size_t x, const size_t y, const size_t z, const Block block) { m_blocks.Set(GetBlockIndex(x, y, z), block); }
+
+	inline const glm::vec3& GetPosition() const noexcept { return m_position; }
+	inline size_t GetVertexCount() const noexcept { return m_vertexCount; }
+	inline bool IsEmpty() const noexcept { return !m_isReadyToRender || m_elementCount == 0; }
+	inline size_t GetVertexBufferSize() const noexcept { return m_vertexCount * sizeof(std::uint32_t); }
+	inline ChunkMeshArena::Draw GetMeshDraw() const noexcept { return ChunkMeshArena::Draw{ m_meshAllocation, m_elementCount, m_position }; }
+	inline const BlockStorage& GetBlocks() const noexcept { return m_blocks; }
+	inline glm::ivec3 GetIndex() const noexcept { return glm::ivec3(m_position) / glm::ivec3(s_ChunkSize); }
+
+	inline bool IsModified() const noexcept { return m_isModified; }
+	inline void MarkAsModified() noexcept { m_isModified = true; }
+
+	inline bool HasAppliedStructureSource(const std::uint8_t sourceIndex) const noexcept { return (m_appliedStructureSources >> sourceIndex) & 1u; }
+	inline std::uint32_t GetAppliedStructureSources() const noexcept { return m_appliedStructureSources; }
+	inline void MarkStructureSourcesApplied(const std::uint32_t sources) noexcept { m_appliedStructureSources |= sources; }
 
 private:
-	void GenerateBlocks();
-	void GenerateMesh();
-	void GenerateVertexObjects() const;
+	static constexpr size_t GetBlockIndex(const size_t x, const size_t y, const size_t z) noexcept { return x * s_ChunkSize.y * s_ChunkSize.z + y * s_ChunkSize.z + z; }
+
+	static void GenerateBufferData(const MeshSnapshot& snapshot, const std::vector<unsigned char>& blockFaces, const size_t faceCount, const BlockRegistry& blockRegistry, MeshData& meshData);
+	static void GenerateGreedyBufferData(const MeshSnapshot& snapshot, const std::vector<unsigned char>& blockFaces, const size_t faceCount, const BlockRegistry& blockRegistry, MeshData& meshData);
+	static void AddFace(MeshData& meshData, const FaceDefinition& face, const glm::tvec3<std::uint32_t>& origin, const glm::tvec3<std::uint32_t>& extent, const std::uint32_t tileIndex);
+	static std::uint32_t PackVertex(const glm::tvec3<std::uint32_t>& position, const std::uint32_t normalIndex, const std::uint32_t tileIndex) noexcept;
 
-	std::vector<unsigned char> GetBlockFaces();
-	void GenerateBufferData(const std::vector<unsigned char>& blockFaces);
-	void AddElements(unsigned int& elementIndex, const unsigned int vertexIndex);
+	static void PlaceTree(std::vector<Block>& blocks, const glm::ivec3& position, const glm::ivec3& location, std::vector<StructureBlock>& structureBlocks);
+	static void PlaceStructureBlock(std::vector<Block>& blocks, const glm::ivec3& position, const glm::ivec3& localPosition, const Block block, std::vector<StructureBlock>& structureBlocks);
 
-	std::string GetBlockTextureName(const Block block, const Direction direction) const;
+	std::vector<Block> GetBorderSlice(const Direction direction) const;
 };
 
 #endif
\ No newline at end of file
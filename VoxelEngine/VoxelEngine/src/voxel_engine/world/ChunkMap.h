@@ -0,0 +1,258 @@
+#pragma once
+#ifndef CHUNK_MAP_H
+#define CHUNK_MAP_H
+
+#include <glm/glm.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+struct ChunkPositionHash
+{
+	inline size_t operator ()(const glm::ivec3& position) const noexcept
+	{
+		std::uint64_t hash = static_cast<std::uint64_t>(static_cast<std::uint32_t>(position.x)) * 0x9E3779B97F4A7C15ull;
+		hash ^= static_cast<std::uint64_t>(static_cast<std::uint32_t>(position.y)) * 0xC2B2AE3D27D4EB4Full;
+		hash ^= static_cast<std::uint64_t>(static_cast<std::uint32_t>(position.z)) * 0x165667B19E3779F9ull;
+
+		hash ^= hash >> 31u;
+		hash *= 0xBF58476D1CE4E5B9ull;
+		hash ^= hash >> 29u;
+
+		return static_cast<size_t>(hash);
+	}
+};
+
+template <typename T>
+class ChunkMap
+{
+public:
+	using value_type = std::pair<glm::ivec3, T>;
+
+private:
+	struct Slot
+	{
+		value_type entry{ glm::ivec3{ 0, 0, 0 }, T{ } };
+		bool isOccupied = false;
+	};
+
+	template <bool IsConst>
+	class Iterator
+	{
+	private:
+		using SlotPointer = std::conditional_t<IsConst, const Slot*, Slot*>;
+
+		SlotPointer m_slot = nullptr;
+		SlotPointer m_end = nullptr;
+
+	public:
+		using iterator_category = std::forward_iterator_tag;
+		using value_type = ChunkMap::value_type;
+		using difference_type = std::ptrdiff_t;
+		using pointer = std::conditional_t<IsConst, const value_type*, value_type*>;
+		using reference = std::conditional_t<IsConst, const value_type&, value_type&>;
+
+		Iterator() = default;
+
+		Iterator(const SlotPointer slot, const SlotPointer end) noexcept
+			: m_slot(slot), m_end(end)
+		{
+			SkipEmptySlots();
+		}
+
+		template <bool WasConst, typename = std::enable_if_t<IsConst && !WasConst>>
+		Iterator(const Iterator<WasConst>& other) noexcept
+			: m_slot(other.GetSlot()), m_end(other.GetEnd())
+		{ }
+
+		inline reference operator *() const noexcept { return m_slot->entry; }
+		inline pointer operator ->() const noexcept { return &m_slot->entry; }
+
+		inline Iterator& operator ++() noexcept
+		{
+			++m_slot;
+			SkipEmptySlots();
+
+			return *this;
+		}
+
+		inline Iterator operator ++(int) noexcept
+		{
+			Iterator previous = *this;
+			++(*this);
+
+			return previous;
+		}
+
+		template <bool OtherIsConst>
+		inline bool operator ==(const Iterator<OtherIsConst>& other) const noexcept { return m_slot == other.GetSlot(); }
+
+		template <bool OtherIsConst>
+		inline bool operator !=(const Iterator<OtherIsConst>& other) const noexcept { return m_slot != other.GetSlot(); }
+
+		inline SlotPointer GetSlot() const noexcept { return m_slot; }
+		inline SlotPointer GetEnd() const noexcept { return m_end; }
+
+	private:
+		inline void SkipEmptySlots() noexcept
+		{
+			while (m_slot != m_end && !m_slot->isOccupied)
+			{
+				++m_slot;
+			}
+		}
+	};
+
+	static constexpr size_t s_MinimumCapacity = 16u;
+
+	std::vector<Slot> m_slots;
+	size_t m_size = 0;
+
+public:
+	using iterator = Iterator<false>;
+	using const_iterator = Iterator<true>;
+
+	ChunkMap() = default;
+	~ChunkMap() noexcept = default;
+
+	inline iterator begin() noexcept { return iterator(m_slots.data(), m_slots.data() + m_slots.size()); }
+	inline iterator end() noexcept { return iterator(m_slots.data() + m_slots.size(), m_slots.data() + m_slots.size()); }
+	inline const_iterator begin() const noexcept { return const_iterator(m_slots.data(), m_slots.data() + m_slots.size()); }
+	inline const_iterator end() const noexcept { return const_iterator(m_slots.data() + m_slots.size(), m_slots.data() + m_slots.size()); }
+
+	inline size_t size() const noexcept { return m_size; }
+	inline bool empty() const noexcept { return m_size == 0; }
+	inline size_t capacity() const noexcept { return m_slots.size(); }
+	inline size_t GetMemoryUsage() const noexcept { return m_slots.size() * sizeof(Slot); }
+
+	iterator find(const glm::ivec3& position) noexcept
+	{
+		const size_t slotIndex = FindSlot(position);
+
+		return slotIndex == m_slots.size() ? end() : iterator(m_slots.data() + slotIndex, m_slots.data() + m_slots.size());
+	}
+
+	const_iterator find(const glm::ivec3& position) const noexcept
+	{
+		const size_t slotIndex = FindSlot(position);
+
+		return slotIndex == m_slots.size() ? end() : const_iterator(m_slots.data() + slotIndex, m_slots.data() + m_slots.size());
+	}
+
+	std::pair<iterator, bool> insert(value_type&& entry)
+	{
+		if (const size_t slotIndex = FindSlot(entry.first);
+			slotIndex != m_slots.size())
+		{
+			return { iterator(m_slots.data() + slotIndex, m_slots.data() + m_slots.size()), false };
+		}
+
+		if ((m_size + 1) * 2 > m_slots.size())
+		{
+			Rehash(std::max(m_slots.size() * 2, s_MinimumCapacity));
+		}
+
+		const size_t slotIndex = InsertIntoFreeSlot(std::move(entry));
+		++m_size;
+
+		return { iterator(m_slots.data() + slotIndex, m_slots.data() + m_slots.size()), true };
+	}
+
+	void erase(const const_iterator& location)
+	{
+		size_t emptyIndex = static_cast<size_t>(location.GetSlot() - m_slots.data());
+		const size_t mask = m_slots.size() - 1;
+
+		for (size_t currentIndex = (emptyIndex + 1) & mask; m_slots[currentIndex].isOccupied; currentIndex = (currentIndex + 1) & mask)
+		{
+			const size_t idealIndex = ChunkPositionHash{ }(m_slots[currentIndex].entry.first) & mask;
+
+			if (((currentIndex - idealIndex) & mask) >= ((currentIndex - emptyIndex) & mask))
+			{
+				m_slots[emptyIndex].entry = std::move(m_slots[currentIndex].entry);
+				emptyIndex = currentIndex;
+			}
+		}
+
+		m_slots[emptyIndex].entry = value_type{ glm::ivec3{ 0, 0, 0 }, T{ } };
+		m_slots[emptyIndex].isOccupied = false;
+		--m_size;
+	}
+
+	size_t erase(const glm::ivec3& position)
+	{
+		if (const const_iterator location = std::as_const(*this).find(position);
+			location != end())
+		{
+			erase(location);
+
+			return 1u;
+		}
+
+		return 0u;
+	}
+
+	void clear()
+	{
+		m_slots.clear();
+		m_size = 0;
+	}
+
+private:
+	size_t FindSlot(const glm::ivec3& position) const noexcept
+	{
+		if (m_slots.empty())
+		{
+			return 0u;
+		}
+
+		const size_t mask = m_slots.size() - 1;
+
+		for (size_t slotIndex = ChunkPositionHash{ }(position) & mask; m_slots[slotIndex].isOccupied; slotIndex = (slotIndex + 1) & mask)
+		{
+			if (m_slots[slotIndex].entry.first == position)
+			{
+				return slotIndex;
+			}
+		}
+
+		return m_slots.size();
+	}
+
+	size_t InsertIntoFreeSlot(value_type&& entry)
+	{
+		const size_t mask = m_slots.size() - 1;
+		size_t slotIndex = ChunkPositionHash{ }(entry.first) & mask;
+
+		while (m_slots[slotIndex].isOccupied)
+		{
+			slotIndex = (slotIndex + 1) & mask;
+		}
+
+		m_slots[slotIndex].entry = std::move(entry);
+		m_slots[slotIndex].isOccupied = true;
+
+		return slotIndex;
+	}
+
+	void Rehash(const size_t capacity)
+	{
+		std::vector<Slot> previousSlots(capacity);
+		std::swap(previousSlots, m_slots);
+
+		for (auto& slot : previousSlots)
+		{
+			if (slot.isOccupied)
+			{
+				InsertIntoFreeSlot(std::move(slot.entry));
+			}
+		}
+	}
+};
+
+#endif
\ No newline at end of file
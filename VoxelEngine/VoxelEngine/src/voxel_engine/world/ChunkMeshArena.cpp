@@ -0,0 +1,214 @@
+#include "ChunkMeshArena.h"
+
+#include <algorithm>
+#include <iterator>
+
+#include "../../engine/graphics/RenderState.h"
+
+ChunkMeshArena::ChunkMeshArena(const QuadElementBuffer& quadElementBuffer, const size_t initialCapacity)
+	: m_quadElementBuffer(quadElementBuffer), m_capacity(RoundUpToGranularity(std::max(initialCapacity, s_AllocationGranularity)))
+{
+	glGenVertexArrays(1, &m_vao);
+	glGenBuffers(1, &m_vertexBuffer);
+	glGenBuffers(1, &m_chunkPositionBuffer);
+	glGenBuffers(1, &m_indirectBuffer);
+
+	glBindBuffer(GL_ARRAY_BUFFER, m_vertexBuffer);
+	glBufferData(GL_ARRAY_BUFFER, m_capacity * sizeof(std::uint32_t), nullptr, GL_DYNAMIC_DRAW);
+	glBindBuffer(GL_ARRAY_BUFFER, 0);
+
+	m_freeBlocks.emplace(0u, m_capacity);
+	SetupVertexArray();
+}
+
+ChunkMeshArena::~ChunkMeshArena() noexcept
+{
+	glDeleteBuffers(1, &m_indirectBuffer);
+	glDeleteBuffers(1, &m_chunkPositionBuffer);
+	glDeleteBuffers(1, &m_vertexBuffer);
+	RenderState::OnVertexArrayDeleted(m_vao);
+	glDeleteVertexArrays(1, &m_vao);
+}
+
+ChunkMeshArena::Allocation ChunkMeshArena::Allocate(const std::vector<std::uint32_t>& vertices)
+{
+	if (vertices.empty())
+	{
+		return Allocation{ };
+	}
+
+	const size_t size = RoundUpToGranularity(vertices.size());
+
+	auto bestBlock = std::end(m_freeBlocks);
+
+	for (auto freeBlock = std::begin(m_freeBlocks); freeBlock != std::end(m_freeBlocks); ++freeBlock)
+	{
+		if (freeBlock->second >= size && (bestBlock == std::end(m_freeBlocks) || freeBlock->second < bestBlock->second))
+		{
+			bestBlock = freeBlock;
+		}
+	}
+
+	if (bestBlock == std::end(m_freeBlocks))
+	{
+		Grow(m_capacity + size);
+
+		return Allocate(vertices);
+	}
+
+	const Allocation allocation{ bestBlock->first, size };
+	const size_t remainingSize = bestBlock->second - size;
+	m_freeBlocks.erase(bestBlock);
+
+	if (remainingSize > 0)
+	{
+		m_freeBlocks.emplace(allocation.offset + size, remainingSize);
+	}
+
+	glBindBuffer(GL_ARRAY_BUFFER, m_vertexBuffer);
+	glBufferSubData(GL_ARRAY_BUFFER, allocation.offset * sizeof(std::uint32_t), vertices.size() * sizeof(std::uint32_t), vertices.data());
+	glBindBuffer(GL_ARRAY_BUFFER, 0);
+
+	m_statistics.usedSize += allocation.size;
+	++m_statistics.allocationCount;
+	++m_statistics.totalAllocationCount;
+
+	return allocation;
+}
+
+void ChunkMeshArena::Free(const Allocation& allocation)
+{
+	if (allocation.size == 0)
+	{
+		return;
+	}
+
+	AddFreeBlock(allocation.offset, allocation.size);
+
+	m_statistics.usedSize -= allocation.size;
+	--m_statistics.allocationCount;
+	++m_statistics.totalFreeCount;
+}
+
+void ChunkMeshArena::Render(const std::vector<Draw>& draws) const
+{
+	if (draws.empty())
+	{
+		return;
+	}
+
+	m_drawCommands.clear();
+	m_chunkPositions.clear();
+
+	for (const auto& draw : draws)
+	{
+		m_drawCommands.push_back(DrawElementsIndirectCommand{ static_cast<GLuint>(draw.elementCount), 1u, 0u, static_cast<GLint>(draw.allocation.offset), static_cast<GLuint>(m_chunkPositions.size()) });
+		m_chunkPositions.push_back(draw.position);
+	}
+
+	glBindBuffer(GL_ARRAY_BUFFER, m_chunkPositionBuffer);
+	glBufferData(GL_ARRAY_BUFFER, m_chunkPositions.size() * sizeof(glm::vec3), m_chunkPositions.data(), GL_STREAM_DRAW);
+	glBindBuffer(GL_ARRAY_BUFFER, 0);
+
+	glBindBuffer(GL_DRAW_INDIRECT_BUFFER, m_indirectBuffer);
+	glBufferData(GL_DRAW_INDIRECT_BUFFER, m_drawCommands.size() * sizeof(DrawElementsIndirectCommand), m_drawCommands.data(), GL_STREAM_DRAW);
+
+	RenderState::BindVertexArray(m_vao);
+	glMultiDrawElementsIndirect(GL_TRIANGLES, QuadElementBuffer::GetElementType(), nullptr, static_cast<GLsizei>(m_drawCommands.size()), 0);
+
+	glBindBuffer(GL_DRAW_INDIRECT_BUFFER, 0);
+}
+
+ChunkMeshArena::Statistics ChunkMeshArena::GetStatistics() const noexcept
+{
+	Statistics statistics = m_statistics;
+	statistics.capacity = m_capacity;
+	statistics.freeBlockCount = m_freeBlocks.size();
+
+	size_t freeSize = 0;
+
+	for (const auto& [offset, size] : m_freeBlocks)
+	{
+		freeSize += size;
+		statistics.largestFreeBlockSize = std::max(statistics.largestFreeBlockSize, size);
+	}
+
+	statistics.fragmentation = freeSize == 0 ? 0.0f : 1.0f - static_cast<float>(statistics.largestFreeBlockSize) / static_cast<float>(freeSize);
+
+	return statistics;
+}
+
+size_t ChunkMeshArena::RoundUpToGranularity(const size_t size) noexcept
+{
+	return (size + s_AllocationGranularity - 1) / s_AllocationGranularity * s_AllocationGranularity;
+}
+
+void ChunkMeshArena::Grow(const size_t minimumCapacity)
+{
+	const size_t previousCapacity = m_capacity;
+	m_capacity = RoundUpToGranularity(std::max(m_capacity * 2, minimumCapacity));
+
+	GLuint vertexBuffer = 0;
+	glGenBuffers(1, &vertexBuffer);
+
+	glBindBuffer(GL_COPY_WRITE_BUFFER, vertexBuffer);
+	glBufferData(GL_COPY_WRITE_BUFFER, m_capacity * sizeof(std::uint32_t), nullptr, GL_DYNAMIC_DRAW);
+
+	glBindBuffer(GL_COPY_READ_BUFFER, m_vertexBuffer);
+	glCopyBufferSubData(GL_COPY_READ_BUFFER, GL_COPY_WRITE_BUFFER, 0, 0, previousCapacity * sizeof(std::uint32_t));
+
+	glBindBuffer(GL_COPY_READ_BUFFER, 0);
+	glBindBuffer(GL_COPY_WRITE_BUFFER, 0);
+
+	glDeleteBuffers(1, &m_vertexBuffer);
+	m_vertexBuffer = vertexBuffer;
+
+	AddFreeBlock(previousCapacity, m_capacity - previousCapacity);
+	SetupVertexArray();
+
+	++m_statistics.growthCount;
+}
+
+void ChunkMeshArena::AddFreeBlock(size_t offset, size_t size)
+{
+	auto nextBlock = m_freeBlocks.lower_bound(offset);
+
+	if (nextBlock != std::begin(m_freeBlocks))
+	{
+		if (const auto previousBlock = std::prev(nextBlock);
+			previousBlock->first + previousBlock->second == offset)
+		{
+			offset = previousBlock->first;
+			size += previousBlock->second;
+			m_freeBlocks.erase(previousBlock);
+		}
+	}
+
+	if (nextBlock != std::end(m_freeBlocks) && offset + size == nextBlock->first)
+	{
+		size += nextBlock->second;
+		m_freeBlocks.erase(nextBlock);
+	}
+
+	m_freeBlocks.emplace(offset, size);
+}
+
+void ChunkMeshArena::SetupVertexArray()
+{
+	RenderState::BindVertexArray(m_vao);
+
+	glBindBuffer(GL_ARRAY_BUFFER, m_vertexBuffer);
+	glEnableVertexAttribArray(s_PackedVertexAttribute);
+	glVertexAttribIPointer(s_PackedVertexAttribute, 1, GL_UNSIGNED_INT, sizeof(std::uint32_t), nullptr);
+
+	glBindBuffer(GL_ARRAY_BUFFER, m_chunkPositionBuffer);
+	glEnableVertexAttribArray(s_ChunkPositionAttribute);
+	glVertexAttribPointer(s_ChunkPositionAttribute, 3, GL_FLOAT, GL_FALSE, sizeof(glm::vec3), nullptr);
+	glVertexAttribDivisor(s_ChunkPositionAttribute, 1u);
+
+	m_quadElementBuffer.Bind();
+
+	RenderState::BindVertexArray(0);
+	glBindBuffer(GL_ARRAY_BUFFER, 0);
+	glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, 0);
+}
\ No newline at end of file
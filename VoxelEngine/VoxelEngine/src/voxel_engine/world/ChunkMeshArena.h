@@ -0,0 +1,98 @@
+#pragma once
+#ifndef CHUNK_MESH_ARENA_H
+#define CHUNK_MESH_ARENA_H
+
+#include "../../engine/interfaces/INoncopyable.h"
+#include "../../engine/interfaces/INonmovable.h"
+
+#include <glad/glad.h>
+#include <glm/glm.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <vector>
+
+#include "../../engine/graphics/QuadElementBuffer.h"
+
+class ChunkMeshArena
+	: private INoncopyable, private INonmovable
+{
+public:
+	struct Allocation
+	{
+		size_t offset = 0;
+		size_t size = 0;
+	};
+
+	struct Draw
+	{
+		Allocation allocation;
+		size_t elementCount = 0;
+		glm::vec3 position{ 0.0f, 0.0f, 0.0f };
+	};
+
+	struct Statistics
+	{
+		size_t capacity = 0;
+		size_t usedSize = 0;
+		size_t allocationCount = 0;
+		size_t freeBlockCount = 0;
+		size_t largestFreeBlockSize = 0;
+		float fragmentation = 0.0f;
+
+		size_t totalAllocationCount = 0;
+		size_t totalFreeCount = 0;
+		size_t growthCount = 0;
+	};
+
+private:
+	struct DrawElementsIndirectCommand
+	{
+		GLuint count;
+		GLuint instanceCount;
+		GLuint firstIndex;
+		GLint baseVertex;
+		GLuint baseInstance;
+	};
+
+	static constexpr GLuint s_PackedVertexAttribute = 0u;
+	static constexpr GLuint s_ChunkPositionAttribute = 1u;
+	static constexpr size_t s_AllocationGranularity = 64u;
+
+	const QuadElementBuffer& m_quadElementBuffer;
+
+	GLuint m_vao = 0;
+	GLuint m_vertexBuffer = 0;
+	GLuint m_chunkPositionBuffer = 0;
+	GLuint m_indirectBuffer = 0;
+
+	size_t m_capacity = 0;
+	std::map<size_t, size_t> m_freeBlocks;
+
+	mutable std::vector<DrawElementsIndirectCommand> m_drawCommands;
+	mutable std::vector<glm::vec3> m_chunkPositions;
+
+	Statistics m_statistics;
+
+public:
+	ChunkMeshArena(const QuadElementBuffer& quadElementBuffer, const size_t initialCapacity);
+	~ChunkMeshArena() noexcept;
+
+	Allocation Allocate(const std::vector<std::uint32_t>& vertices);
+	void Free(const Allocation& allocation);
+
+	void Render(const std::vector<Draw>& draws) const;
+
+	Statistics GetStatistics() const noexcept;
+	inline size_t GetMemoryUsage() const noexcept { return m_capacity * sizeof(std::uint32_t); }
+
+private:
+	static size_t RoundUpToGranularity(const size_t size) noexcept;
+
+	void Grow(const size_t minimumCapacity);
+	void AddFreeBlock(size_t offset, size_t size);
+	void SetupVertexArray();
+};
+
+#endif
\ No newline at end of file
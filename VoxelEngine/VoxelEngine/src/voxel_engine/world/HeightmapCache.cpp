@@ -0,0 +1,98 @@
+#include "HeightmapCache.h"
+
+#include <algorithm>
+#include <iterator>
+#include <vector>
+
+#include "../../engine/utility/SimplexNoise.h"
+
+HeightmapCache::HeightmapCache(const unsigned int seed, const size_t capacity)
+	: m_seed(seed), m_capacity(std::max<size_t>(capacity, 1))
+{ }
+
+HeightmapCache::Heightmap HeightmapCache::GetHeightmap(const glm::ivec3& columnPosition)
+{
+	const glm::ivec3 columnKey{ columnPosition.x, 0, columnPosition.z };
+
+	{
+		const std::lock_guard<std::mutex> lock(m_heightmapMutex);
+
+		if (const auto location = m_heightmaps.find(columnKey);
+			location != std::end(m_heightmaps))
+		{
+			m_recentColumns.splice(std::begin(m_recentColumns), m_recentColumns, location->second.recentColumnLocation);
+			++m_statistics.hitCount;
+
+			return location->second.heights;
+		}
+	}
+
+	size_t noiseEvaluationCount = 0;
+	const Heightmap heights = GenerateHeightmap(columnKey, noiseEvaluationCount);
+
+	const std::lock_guard<std::mutex> lock(m_heightmapMutex);
+	++m_statistics.missCount;
+	m_statistics.noiseEvaluationCount += noiseEvaluationCount;
+
+	if (const auto location = m_heightmaps.find(columnKey);
+		location != std::end(m_heightmaps))
+	{
+		m_recentColumns.splice(std::begin(m_recentColumns), m_recentColumns, location->second.recentColumnLocation);
+
+		return location->second.heights;
+	}
+
+	if (m_heightmaps.size() >= m_capacity)
+	{
+		m_heightmaps.erase(m_recentColumns.back());
+		m_recentColumns.pop_back();
+	}
+
+	m_recentColumns.push_front(columnKey);
+	m_heightmaps.insert({ columnKey, Entry{ heights, std::begin(m_recentColumns) } });
+
+	return heights;
+}
+
+HeightmapCache::Statistics HeightmapCache::GetStatistics() const
+{
+	const std::lock_guard<std::mutex> lock(m_heightmapMutex);
+
+	return m_statistics;
+}
+
+HeightmapCache::Heightmap HeightmapCache::GenerateHeightmap(const glm::ivec3& columnPosition, size_t& noiseEvaluationCount) const
+{
+	const glm::vec3 position(columnPosition);
+
+	std::vector<glm::vec2> continentPositions;
+	std::vector<glm::vec2> detailPositions;
+	continentPositions.reserve(Chunk::GetSize().x * Chunk::GetSize().z);
+	detailPositions.reserve(Chunk::GetSize().x * Chunk::GetSize().z);
+
+	for (size_t x = 0; x < Chunk::GetSize().x; ++x)
+	{
+		for (size_t z = 0; z < Chunk::GetSize().z; ++z)
+		{
+			continentPositions.push_back(glm::vec2{ (x + position.x + m_seed) / 128.0f, (z + position.z + m_seed) / 64.0f });
+			detailPositions.push_back(glm::vec2{ (x + position.x - m_seed) / 64.0f, (z + position.z - m_seed) / 128.0f });
+		}
+	}
+
+	std::vector<float> continentNoise;
+	std::vector<float> detailNoise;
+	SimplexNoise::Generate2D(continentPositions, continentNoise);
+	SimplexNoise::Generate2D(detailPositions, detailNoise);
+
+	Heightmap heights{ };
+
+	for (size_t i = 0; i < heights.size(); ++i)
+	{
+		heights[i] = static_cast<unsigned int>(glm::ceil(continentNoise[i] * 4.0f));
+		heights[i] += static_cast<unsigned int>(glm::ceil(detailNoise[i] * 8.0f + 32.0f));
+	}
+
+	noiseEvaluationCount = continentNoise.size() + detailNoise.size();
+
+	return heights;
+}
\ No newline at end of file
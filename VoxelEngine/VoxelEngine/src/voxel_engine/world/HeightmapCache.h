@@ -0,0 +1,62 @@
+#pragma once
+#ifndef HEIGHTMAP_CACHE_H
+#define HEIGHTMAP_CACHE_H
+
+#include "../../engine/interfaces/INoncopyable.h"
+#include "../../engine/interfaces/INonmovable.h"
+
+#include <glm/glm.hpp>
+
+#include <array>
+#include <cstddef>
+#include <list>
+#include <mutex>
+#include <unordered_map>
+
+#include "Chunk.h"
+#include "ChunkMap.h"
+
+class HeightmapCache
+	: private INoncopyable, private INonmovable
+{
+public:
+	using Heightmap = std::array<unsigned int, Chunk::GetSize().x * Chunk::GetSize().z>;
+
+	struct Statistics
+	{
+		size_t hitCount = 0;
+		size_t missCount = 0;
+		size_t noiseEvaluationCount = 0;
+	};
+
+private:
+	struct Entry
+	{
+		Heightmap heights{ };
+		std::list<glm::ivec3>::iterator recentColumnLocation;
+	};
+
+	unsigned int m_seed = 0;
+	size_t m_capacity = 0;
+
+	std::unordered_map<glm::ivec3, Entry, ChunkPositionHash> m_heightmaps;
+	std::list<glm::ivec3> m_recentColumns;
+	mutable std::mutex m_heightmapMutex;
+
+	Statistics m_statistics;
+
+public:
+	static constexpr size_t GetHeightIndex(const size_t x, const size_t z) noexcept { return x * Chunk::GetSize().z + z; }
+
+	HeightmapCache(const unsigned int seed, const size_t capacity);
+	~HeightmapCache() noexcept = default;
+
+	Heightmap GetHeightmap(const glm::ivec3& columnPosition);
+
+	Statistics GetStatistics() const;
+
+private:
+	Heightmap GenerateHeightmap(const glm::ivec3& columnPosition, size_t& noiseEvaluationCount) const;
+};
+
+#endif
\ No newline at end of file
@@ -0,0 +1,355 @@
+#include "RegionFile.h"
+
+#include <magic_enum/magic_enum.hpp>
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <filesystem>
+#include <iterator>
+#include <sstream>
+#include <utility>
+
+#include "../../engine/utility/Logger.h"
+
+std::vector<std::uint8_t> RegionFile::CompressBlocks(const std::vector<Block>& blocks)
+{
+	std::vector<Block> palette;
+	std::vector<std::uint32_t> paletteIndices;
+	paletteIndices.reserve(blocks.size());
+
+	for (const Block block : blocks)
+	{
+		const auto paletteLocation = std::find(std::cbegin(palette), std::cend(palette), block);
+
+		if (paletteLocation == std::cend(palette))
+		{
+			paletteIndices.push_back(static_cast<std::uint32_t>(palette.size()));
+			palette.push_back(block);
+		}
+		else
+		{
+			paletteIndices.push_back(static_cast<std::uint32_t>(std::distance(std::cbegin(palette), paletteLocation)));
+		}
+	}
+
+	std::vector<std::uint8_t> data;
+	WriteVarInt(data, static_cast<std::uint32_t>(palette.size()));
+
+	for (const Block block : palette)
+	{
+		WriteVarInt(data, static_cast<std::uint32_t>(block));
+	}
+
+	size_t runStart = 0;
+
+	while (runStart < paletteIndices.size())
+	{
+		size_t runEnd = runStart + 1;
+
+		while (runEnd < paletteIndices.size() && paletteIndices[runEnd] == paletteIndices[runStart])
+		{
+			++runEnd;
+		}
+
+		WriteVarInt(data, static_cast<std::uint32_t>(runEnd - runStart));
+		WriteVarInt(data, paletteIndices[runStart]);
+
+		runStart = runEnd;
+	}
+
+	return data;
+}
+
+std::optional<std::vector<Block>> RegionFile::DecompressBlocks(const std::vector<std::uint8_t>& data, const size_t blockCount, size_t& position)
+{
+	const std::optional<std::uint32_t> paletteSize = ReadVarInt(data, position);
+
+	if (!paletteSize.has_value() || paletteSize.value() > blockCount)
+	{
+		return std::nullopt;
+	}
+
+	std::vector<Block> palette;
+	palette.reserve(paletteSize.value());
+
+	for (std::uint32_t i = 0; i < paletteSize.value(); ++i)
+	{
+		const std::optional<std::uint32_t> blockID = ReadVarInt(data, position);
+
+		if (!blockID.has_value() || blockID.value() >= magic_enum::enum_count<Block>())
+		{
+			return std::nullopt;
+		}
+
+		palette.push_back(static_cast<Block>(blockID.value()));
+	}
+
+	std::vector<Block> blocks;
+	blocks.reserve(blockCount);
+
+	while (blocks.size() < blockCount)
+	{
+		const std::optional<std::uint32_t> runLength = ReadVarInt(data, position);
+		const std::optional<std::uint32_t> paletteIndex = ReadVarInt(data, position);
+
+		if (!runLength.has_value() || !paletteIndex.has_value() || paletteIndex.value() >= palette.size() || runLength.value() > blockCount - blocks.size())
+		{
+			return std::nullopt;
+		}
+
+		blocks.insert(std::end(blocks), runLength.value(), palette[paletteIndex.value()]);
+	}
+
+	return blocks;
+}
+
+RegionFile::RegionFile(const std::string& filePath, const unsigned int chunkHeight)
+	: m_filePath(filePath), m_chunkHeight(chunkHeight), m_chunkLocations(static_cast<size_t>(s_RegionSize) * s_RegionSize * chunkHeight)
+{
+	m_file.open(m_filePath, std::ios_base::in | std::ios_base::out | std::ios_base::binary);
+
+	if (m_file.is_open() && !ReadHeader())
+	{
+		m_file.close();
+		MoveInvalidFile();
+	}
+
+	if (!m_file.is_open() && !std::filesystem::exists(m_filePath))
+	{
+		CreateHeader();
+	}
+}
+
+std::optional<RegionFile::ChunkData> RegionFile::ReadChunk(const glm::ivec3& localChunkPosition, const size_t blockCount)
+{
+	const ChunkLocation& chunkLocation = m_chunkLocations[GetChunkSlot(localChunkPosition)];
+
+	if (chunkLocation.size == 0)
+	{
+		return std::nullopt;
+	}
+
+	std::vector<std::uint8_t> data(chunkLocation.size);
+
+	m_file.seekg(chunkLocation.offset);
+	m_file.read(reinterpret_cast<char*>(data.data()), static_cast<std::streamsize>(data.size()));
+
+	if (!m_file)
+	{
+		m_file.clear();
+
+		return std::nullopt;
+	}
+
+	size_t position = 0;
+	std::optional<std::vector<Block>> blocks = DecompressBlocks(data, blockCount, position);
+
+	if (!blocks.has_value())
+	{
+		return std::nullopt;
+	}
+
+	const std::optional<std::uint32_t> appliedStructureSources = ReadVarInt(data, position);
+
+	return ChunkData{ std::move(blocks.value()), appliedStructureSources.value_or(s_AllStructureSources) };
+}
+
+bool RegionFile::WriteChunk(const glm::ivec3& localChunkPosition, const ChunkData& chunkData)
+{
+	if (!m_file.is_open())
+	{
+		return false;
+	}
+
+	std::vector<std::uint8_t> data = CompressBlocks(chunkData.blocks);
+	WriteVarInt(data, chunkData.appliedStructureSources);
+
+	// The payload always goes to space that no live entry uses, so the previous copy stays readable until the new table entry is on disk.
+	const size_t slot = GetChunkSlot(localChunkPosition);
+	const ChunkLocation previousChunkLocation = m_chunkLocations[slot];
+	const ChunkLocation chunkLocation{ FindFreeOffset(static_cast<std::uint32_t>(data.size())), static_cast<std::uint32_t>(data.size()) };
+
+	m_file.seekp(chunkLocation.offset);
+	m_file.write(reinterpret_cast<const char*>(data.data()), static_cast<std::streamsize>(data.size()));
+	m_file.flush();
+
+	if (!m_file)
+	{
+		m_file.clear();
+
+		return false;
+	}
+
+	m_fileSize = std::max(m_fileSize, chunkLocation.offset + chunkLocation.size);
+	m_chunkLocations[slot] = chunkLocation;
+
+	if (!WriteChunkLocation(slot))
+	{
+		m_chunkLocations[slot] = previousChunkLocation;
+
+		return false;
+	}
+
+	return true;
+}
+
+void RegionFile::WriteVarInt(std::vector<std::uint8_t>& data, std::uint32_t value)
+{
+	while (value >= 0x80u)
+	{
+		data.push_back(static_cast<std::uint8_t>(value | 0x80u));
+		value >>= 7u;
+	}
+
+	data.push_back(static_cast<std::uint8_t>(value));
+}
+
+std::optional<std::uint32_t> RegionFile::ReadVarInt(const std::vector<std::uint8_t>& data, size_t& position) noexcept
+{
+	std::uint32_t value = 0;
+
+	for (unsigned int shift = 0; shift < 32u && position < data.size(); shift += 7u)
+	{
+		const std::uint8_t byte = data[position++];
+		value |= static_cast<std::uint32_t>(byte & 0x7Fu) << shift;
+
+		if ((byte & 0x80u) == 0)
+		{
+			return value;
+		}
+	}
+
+	return std::nullopt;
+}
+
+bool RegionFile::ReadHeader()
+{
+	std::array<std::uint32_t, s_HeaderFieldCount> headerFields{ };
+
+	m_file.seekg(0, std::ios_base::end);
+	const std::streamoff fileSize = m_file.tellg();
+
+	m_file.seekg(0);
+	m_file.read(reinterpret_cast<char*>(headerFields.data()), sizeof(headerFields));
+	m_file.read(reinterpret_cast<char*>(m_chunkLocations.data()), static_cast<std::streamsize>(m_chunkLocations.size() * sizeof(ChunkLocation)));
+
+	if (!m_file || headerFields != std::array<std::uint32_t, s_HeaderFieldCount>{ s_FileSignature, s_FileVersion, static_cast<std::uint32_t>(s_RegionSize), m_chunkHeight })
+	{
+		m_file.clear();
+
+		return false;
+	}
+
+	m_fileSize = static_cast<std::uint32_t>(fileSize);
+	size_t invalidChunkCount = 0;
+
+	for (auto& chunkLocation : m_chunkLocations)
+	{
+		if (chunkLocation.size != 0 && (chunkLocation.offset < GetHeaderSize() || static_cast<std::uint64_t>(chunkLocation.offset) + chunkLocation.size > m_fileSize))
+		{
+			chunkLocation = ChunkLocation{ };
+			++invalidChunkCount;
+		}
+	}
+
+	if (invalidChunkCount > 0)
+	{
+		std::ostringstream messageStream;
+		messageStream << "Region file " << m_filePath << " has " << invalidChunkCount << " invalid chunk entries; those chunks will be regenerated.";
+
+		Logger::Log(messageStream.str());
+	}
+
+	return true;
+}
+
+bool RegionFile::MoveInvalidFile() const
+{
+	const std::string invalidFilePath = m_filePath + "." + std::to_string(std::chrono::system_clock::now().time_since_epoch().count()) + ".invalid";
+
+	std::error_code errorCode;
+	std::filesystem::rename(m_filePath, invalidFilePath, errorCode);
+
+	if (errorCode)
+	{
+		Logger::Log("Region file " + m_filePath + " is invalid and could not be moved aside: " + errorCode.message());
+
+		return false;
+	}
+
+	Logger::Log("Region file " + m_filePath + " is invalid; moved to " + invalidFilePath + ".");
+
+	return true;
+}
+
+bool RegionFile::CreateHeader()
+{
+	m_file.close();
+	m_file.open(m_filePath, std::ios_base::in | std::ios_base::out | std::ios_base::binary | std::ios_base::trunc);
+
+	if (!m_file.is_open())
+	{
+		return false;
+	}
+
+	std::fill(std::begin(m_chunkLocations), std::end(m_chunkLocations), ChunkLocation{ });
+
+	const std::array<std::uint32_t, s_HeaderFieldCount> headerFields{ s_FileSignature, s_FileVersion, static_cast<std::uint32_t>(s_RegionSize), m_chunkHeight };
+	m_file.write(reinterpret_cast<const char*>(headerFields.data()), sizeof(headerFields));
+	m_file.write(reinterpret_cast<const char*>(m_chunkLocations.data()), static_cast<std::streamsize>(m_chunkLocations.size() * sizeof(ChunkLocation)));
+	m_file.flush();
+
+	m_fileSize = GetHeaderSize();
+
+	return static_cast<bool>(m_file);
+}
+
+bool RegionFile::WriteChunkLocation(const size_t slot)
+{
+	m_file.seekp(s_HeaderFieldCount * sizeof(std::uint32_t) + slot * sizeof(ChunkLocation));
+	m_file.write(reinterpret_cast<const char*>(&m_chunkLocations[slot]), sizeof(ChunkLocation));
+	m_file.flush();
+
+	if (!m_file)
+	{
+		m_file.clear();
+
+		return false;
+	}
+
+	return true;
+}
+
+std::uint32_t RegionFile::FindFreeOffset(const std::uint32_t size) const
+{
+	std::vector<ChunkLocation> usedChunkLocations;
+
+	for (const auto& chunkLocation : m_chunkLocations)
+	{
+		if (chunkLocation.size != 0)
+		{
+			usedChunkLocations.push_back(chunkLocation);
+		}
+	}
+
+	std::sort(std::begin(usedChunkLocations), std::end(usedChunkLocations), [](const ChunkLocation& lhs, const ChunkLocation& rhs)
+	{
+		return lhs.offset < rhs.offset;
+	});
+
+	std::uint32_t gapStart = GetHeaderSize();
+
+	for (const auto& chunkLocation : usedChunkLocations)
+	{
+		if (chunkLocation.offset >= gapStart && chunkLocation.offset - gapStart >= size)
+		{
+			return gapStart;
+		}
+
+		gapStart = std::max(gapStart, chunkLocation.offset + chunkLocation.size);
+	}
+
+	// Everything past the last live payload is dead space, so writing there may reuse it and extend the file as needed.
+	return gapStart;
+}
\ No newline at end of file
@@ -0,0 +1,76 @@
+#pragma once
+#ifndef REGION_FILE_H
+#define REGION_FILE_H
+
+#include "../../engine/interfaces/INoncopyable.h"
+#include "../../engine/interfaces/INonmovable.h"
+
+#include <glm/glm.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <fstream>
+#include <optional>
+#include <string>
+#include <vector>
+
+#include "Block.h"
+
+class RegionFile
+	: private INoncopyable, private INonmovable
+{
+public:
+	static constexpr int s_RegionSize = 32;
+	static constexpr std::uint32_t s_AllStructureSources = (1u << 27u) - 1u;
+
+	struct ChunkData
+	{
+		std::vector<Block> blocks;
+		std::uint32_t appliedStructureSources = 0u;
+	};
+
+private:
+	struct ChunkLocation
+	{
+		std::uint32_t offset = 0;
+		std::uint32_t size = 0;
+	};
+
+	static constexpr std::uint32_t s_FileSignature = 0x47525856u;
+	static constexpr std::uint32_t s_FileVersion = 1u;
+	static constexpr size_t s_HeaderFieldCount = 4u;
+
+	std::fstream m_file;
+	std::string m_filePath;
+
+	unsigned int m_chunkHeight = 0;
+	std::vector<ChunkLocation> m_chunkLocations;
+	std::uint32_t m_fileSize = 0;
+
+public:
+	static std::vector<std::uint8_t> CompressBlocks(const std::vector<Block>& blocks);
+	static std::optional<std::vector<Block>> DecompressBlocks(const std::vector<std::uint8_t>& data, const size_t blockCount, size_t& position);
+
+	RegionFile(const std::string& filePath, const unsigned int chunkHeight);
+	~RegionFile() noexcept = default;
+
+	std::optional<ChunkData> ReadChunk(const glm::ivec3& localChunkPosition, const size_t blockCount);
+	bool WriteChunk(const glm::ivec3& localChunkPosition, const ChunkData& chunkData);
+
+	inline bool IsOpen() const noexcept { return m_file.is_open(); }
+
+private:
+	static void WriteVarInt(std::vector<std::uint8_t>& data, std::uint32_t value);
+	static std::optional<std::uint32_t> ReadVarInt(const std::vector<std::uint8_t>& data, size_t& position) noexcept;
+
+	bool ReadHeader();
+	bool MoveInvalidFile() const;
+	bool CreateHeader();
+	bool WriteChunkLocation(const size_t slot);
+	std::uint32_t FindFreeOffset(const std::uint32_t size) const;
+
+	inline std::uint32_t GetHeaderSize() const noexcept { return static_cast<std::uint32_t>(s_HeaderFieldCount * sizeof(std::uint32_t) + m_chunkLocations.size() * sizeof(ChunkLocation)); }
+	inline size_t GetChunkSlot(const glm::ivec3& localChunkPosition) const noexcept { return (static_cast<size_t>(localChunkPosition.x) * s_RegionSize + localChunkPosition.z) * m_chunkHeight + localChunkPosition.y; }
+};
+
+#endif
\ No newline at end of file
@@ -0,0 +1,186 @@
+#include "RegionStorage.h"
+
+#include <filesystem>
+#include <iterator>
+#include <fstream>
+#include <limits>
+#include <sstream>
+
+#include "../../engine/utility/Logger.h"
+#include "../../engine/utility/Random.h"
+
+RegionStorage::RegionStorage(const std::string& saveDirectory, const unsigned int chunkHeight, const size_t chunkBlockCount)
+	: m_saveDirectory(saveDirectory), m_chunkHeight(chunkHeight), m_chunkBlockCount(chunkBlockCount)
+{
+	std::error_code errorCode;
+	std::filesystem::create_directories(m_saveDirectory, errorCode);
+
+	if (errorCode)
+	{
+		Logger::Log("Could not create save directory " + m_saveDirectory + ": " + errorCode.message());
+	}
+
+	if (const std::optional<unsigned int> seed = ReadSeed();
+		seed.has_value())
+	{
+		m_seed = seed.value();
+		m_isSeedSaved = true;
+
+		return;
+	}
+
+	m_seed = Random::GenerateInt(0u, static_cast<unsigned int>(std::numeric_limits<unsigned short>::max()));
+	m_isSeedSaved = WriteSeed(m_seed);
+
+	// Chunks saved without their seed would be mixed with differently generated terrain the next time the world is loaded.
+	if (!m_isSeedSaved)
+	{
+		Logger::Log("Could not save the world seed to " + m_saveDirectory + "/" + s_seedFileName + "; chunks will not be saved.");
+	}
+}
+
+std::optional<RegionFile::ChunkData> RegionStorage::LoadChunk(const glm::ivec3& chunkIndex)
+{
+	const std::shared_ptr<Region> region = GetRegion(chunkIndex);
+
+	if (region == nullptr)
+	{
+		return std::nullopt;
+	}
+
+	const std::lock_guard<std::mutex> lock(region->mutex);
+
+	if (RegionFile* const regionFile = OpenRegionFile(*region, false);
+		regionFile != nullptr)
+	{
+		return regionFile->ReadChunk(GetLocalChunkPosition(chunkIndex), m_chunkBlockCount);
+	}
+
+	return std::nullopt;
+}
+
+void RegionStorage::SaveChunk(const glm::ivec3& chunkIndex, const RegionFile::ChunkData& chunkData)
+{
+	if (!m_isSeedSaved)
+	{
+		return;
+	}
+
+	const std::shared_ptr<Region> region = GetRegion(chunkIndex);
+	bool isSaved = false;
+
+	if (region != nullptr)
+	{
+		const std::lock_guard<std::mutex> lock(region->mutex);
+
+		if (RegionFile* const regionFile = OpenRegionFile(*region, true);
+			regionFile != nullptr)
+		{
+			isSaved = regionFile->WriteChunk(GetLocalChunkPosition(chunkIndex), chunkData);
+		}
+	}
+
+	if (!isSaved)
+	{
+		std::ostringstream messageStream;
+		messageStream << "Could not save chunk (" << chunkIndex.x << ", " << chunkIndex.y << ", " << chunkIndex.z << ").";
+
+		Logger::Log(messageStream.str());
+	}
+}
+
+glm::ivec2 RegionStorage::GetRegionPosition(const glm::ivec3& chunkIndex)
+{
+	return glm::floor(glm::vec2{ chunkIndex.x, chunkIndex.z } / static_cast<float>(RegionFile::s_RegionSize));
+}
+
+glm::ivec3 RegionStorage::GetLocalChunkPosition(const glm::ivec3& chunkIndex)
+{
+	const glm::ivec2 regionPosition = GetRegionPosition(chunkIndex);
+
+	return glm::ivec3{ chunkIndex.x - regionPosition.x * RegionFile::s_RegionSize, chunkIndex.y, chunkIndex.z - regionPosition.y * RegionFile::s_RegionSize };
+}
+
+std::shared_ptr<RegionStorage::Region> RegionStorage::GetRegion(const glm::ivec3& chunkIndex)
+{
+	if (chunkIndex.y < 0 || chunkIndex.y >= static_cast<int>(m_chunkHeight))
+	{
+		return nullptr;
+	}
+
+	const glm::ivec2 regionPosition = GetRegionPosition(chunkIndex);
+	const std::uint64_t regionKey = (static_cast<std::uint64_t>(static_cast<std::uint32_t>(regionPosition.x)) << 32u) | static_cast<std::uint32_t>(regionPosition.y);
+
+	const std::lock_guard<std::mutex> lock(m_regionMutex);
+
+	if (const auto location = m_regions.find(regionKey);
+		location != std::end(m_regions))
+	{
+		m_recentRegions.splice(std::begin(m_recentRegions), m_recentRegions, location->second.recentRegionLocation);
+
+		return location->second.region;
+	}
+
+	// Only regions that no other thread holds are closed, so a file is never open twice; the cache overshoots while all of them are in use.
+	auto recentRegionLocation = std::end(m_recentRegions);
+
+	while (m_regions.size() >= s_MaxOpenRegionCount && recentRegionLocation != std::begin(m_recentRegions))
+	{
+		--recentRegionLocation;
+
+		if (const auto location = m_regions.find(*recentRegionLocation);
+			location->second.region.use_count() == 1)
+		{
+			m_regions.erase(location);
+			recentRegionLocation = m_recentRegions.erase(recentRegionLocation);
+		}
+	}
+
+	std::ostringstream filePathStream;
+	filePathStream << m_saveDirectory << "/region." << regionPosition.x << "." << regionPosition.y << ".dat";
+
+	const std::shared_ptr<Region> region = std::make_shared<Region>();
+	region->filePath = filePathStream.str();
+
+	m_recentRegions.push_front(regionKey);
+	m_regions.insert({ regionKey, RegionEntry{ region, std::begin(m_recentRegions) } });
+
+	return region;
+}
+
+RegionFile* RegionStorage::OpenRegionFile(Region& region, const bool createIfMissing) const
+{
+	if (region.file == nullptr && (createIfMissing || !region.hasCheckedFile))
+	{
+		region.hasCheckedFile = true;
+
+		if (createIfMissing || std::filesystem::exists(region.filePath))
+		{
+			region.file = std::make_unique<RegionFile>(region.filePath, m_chunkHeight);
+		}
+	}
+
+	return region.file != nullptr && region.file->IsOpen() ? region.file.get() : nullptr;
+}
+
+std::optional<unsigned int> RegionStorage::ReadSeed() const
+{
+	unsigned int seed = 0;
+
+	if (std::ifstream seedFile(m_saveDirectory + "/" + s_seedFileName, std::ios_base::in | std::ios_base::binary);
+		seedFile.read(reinterpret_cast<char*>(&seed), sizeof(seed)))
+	{
+		return seed;
+	}
+
+	return std::nullopt;
+}
+
+bool RegionStorage::WriteSeed(const unsigned int seed) const
+{
+	std::ofstream seedFile(m_saveDirectory + "/" + s_seedFileName, std::ios_base::out | std::ios_base::binary | std::ios_base::trunc);
+	seedFile.write(reinterpret_cast<const char*>(&seed), sizeof(seed));
+	seedFile.flush();
+
+	return static_cast<bool>(seedFile);
+}
\ No newline at end of file
@@ -0,0 +1,75 @@
+#pragma once
+#ifndef REGION_STORAGE_H
+#define REGION_STORAGE_H
+
+#include "../../engine/interfaces/INoncopyable.h"
+#include "../../engine/interfaces/INonmovable.h"
+
+#include <glm/glm.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "Block.h"
+#include "RegionFile.h"
+
+class RegionStorage
+	: private INoncopyable, private INonmovable
+{
+private:
+	struct Region
+	{
+		std::mutex mutex;
+		std::string filePath;
+		std::unique_ptr<RegionFile> file = nullptr;
+		bool hasCheckedFile = false;
+	};
+
+	struct RegionEntry
+	{
+		std::shared_ptr<Region> region = nullptr;
+		std::list<std::uint64_t>::iterator recentRegionLocation;
+	};
+
+	static constexpr size_t s_MaxOpenRegionCount = 16u;
+
+	inline static const std::string s_seedFileName = "seed.dat";
+
+	std::string m_saveDirectory;
+	unsigned int m_chunkHeight = 0;
+	size_t m_chunkBlockCount = 0;
+	unsigned int m_seed = 0;
+	bool m_isSeedSaved = false;
+
+	std::unordered_map<std::uint64_t, RegionEntry> m_regions;
+	std::list<std::uint64_t> m_recentRegions;
+	std::mutex m_regionMutex;
+
+public:
+	RegionStorage(const std::string& saveDirectory, const unsigned int chunkHeight, const size_t chunkBlockCount);
+	~RegionStorage() noexcept = default;
+
+	std::optional<RegionFile::ChunkData> LoadChunk(const glm::ivec3& chunkIndex);
+	void SaveChunk(const glm::ivec3& chunkIndex, const RegionFile::ChunkData& chunkData);
+
+	inline unsigned int GetSeed() const noexcept { return m_seed; }
+	inline bool CanSaveChunks() const noexcept { return m_isSeedSaved; }
+
+private:
+	static glm::ivec2 GetRegionPosition(const glm::ivec3& chunkIndex);
+	static glm::ivec3 GetLocalChunkPosition(const glm::ivec3& chunkIndex);
+
+	std::shared_ptr<Region> GetRegion(const glm::ivec3& chunkIndex);
+	RegionFile* OpenRegionFile(Region& region, const bool createIfMissing) const;
+	std::optional<unsigned int> ReadSeed() const;
+	bool WriteSeed(const unsigned int seed) const;
+};
+
+#endif
\ No newline at end of file
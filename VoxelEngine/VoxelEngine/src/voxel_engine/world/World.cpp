@@ -2,10 +2,16 @@
 
 #include <magic_enum/magic_enum.hpp>
 
+#include <algorithm>
+#include <chrono>
 #include <iterator>
+#include <limits>
+#include <sstream>
 #include <utility>
 
-#include "../../engine/Game.h"
+#include "../../engine/graphics/RenderState.h"
+#include "../../engine/graphics/Vertex.h"
+#include "../../engine/utility/Logger.h"
 
 glm::ivec3 World::WorldCoordinatesToChunkCoordinates(const int x, const int y, const int z)
 {
@@ -16,80 +22,69 @@ glm::ivec3 World::WorldCoordinatesToChunkCoordinates(const int x, const int y, c
 	};
 }
 
-World::World(const TileMap& tileMap, const Camera3D& camera, const Sound& breakSound, const Sound& placeSound, const Sound& switchSound, const Game& game)
-	: m_tileMap(&tileMap), m_camera(camera), m_blockBreakSound(breakSound), m_blockPlaceSound(placeSound), m_blockSwitchSound(switchSound), m_game(game)
+World::World(const TileMap& tileMap, const Camera3D& camera, const Sound& breakSound, const Sound& placeSound, const Sound& switchSound, const Config& config)
+	: m_tileMap(&tileMap), m_blockRegistry(tileMap), m_regionStorage(config.saveDirectory, s_ChunkHeight, Chunk::GetSize().x * Chunk::GetSize().y * Chunk::GetSize().z),
+	  m_heightmapCache(m_regionStorage.GetSeed(), GetHeightmapCacheCapacity(std::max(config.chunkUnloadRadius, config.chunkLoadRadius))), m_camera(camera),
+	  m_chunkMeshArena(m_quadElementBuffer, GetChunkMeshArenaCapacity(config.chunkLoadRadius)),
+	  m_chunkLoadRadius(static_cast<int>(config.chunkLoadRadius)), m_chunkUnloadRadius(static_cast<int>(std::max(config.chunkUnloadRadius, config.chunkLoadRadius))), m_chunkLoadsPerFrame(std::max(config.chunkLoadsPerFrame, 1u)),
+	  m_meshingMode(config.enableGreedyMeshing ? Chunk::MeshingMode::Greedy : Chunk::MeshingMode::PerFace), m_workerThreads(config.workerThreadCount),
+	  m_blockBreakSound(breakSound), m_blockPlaceSound(placeSound), m_blockSwitchSound(switchSound)
 {
-	const glm::ivec3 cameraPosition = m_camera.GetPosition();
+	m_streamingCentre = GetCameraChunkColumn();
 
-	for (int x = 0; x <= cameraPosition.x + s_RenderDistance; ++x)
+	for (const auto& chunkPosition : GetChunksWithinLoadRadius())
 	{
-		for (unsigned int y = 0; y < s_ChunkHeight; ++y)
-		{
-			for (int z = 0; z <= cameraPosition.z + s_RenderDistance; ++z)
-			{
-				const glm::vec3 currentPosition{ x * static_cast<float>(Chunk::GetSize().x), y * static_cast<float>(Chunk::GetSize().y), z * static_cast<float>(Chunk::GetSize().z) };
-
-				m_chunks.insert({ WorldCoordinatesToChunkCoordinates(static_cast<int>(currentPosition.x), static_cast<int>(currentPosition.y), static_cast<int>(currentPosition.z)), std::make_unique<Chunk>(currentPosition, *this, tileMap) });
-			}
-		}
+		m_chunks.insert({ chunkPosition, std::make_unique<Chunk>(glm::vec3(chunkPosition), *this) });
 	}
 
-	for (const auto& treeLocation : m_treeLocations)
+	GenerateChunks();
+
+	std::unordered_set<glm::ivec3, ChunkPositionHash> modifiedChunks;
+
+	for (auto& [position, chunk] : m_chunks)
 	{
-		CreateTree(treeLocation.x, treeLocation.y, treeLocation.z);
+		PlaceStructureBlocks(*chunk, modifiedChunks);
 	}
 
-	for (auto& [position, chunk] : m_chunks)
+	LogBlockMemoryUsage();
+	MeshChunks();
+}
+
+World::~World() noexcept
+{
+	m_workerThreads.WaitForJobs();
+
+	for (const auto& [position, chunk] : m_chunks)
 	{
-		chunk->Create();
+		SaveChunk(*chunk);
 	}
 }
 
-void World::ProcessInput(const KeyboardState& keyboardState, const MouseState& mouseState, const Sint32 scrollState, const GameControllerState& gameControllerState, const glm::mat4& perspectiveMatrix)
+void World::ProcessInput(const KeyboardState& keyboardState, const MouseState& mouseState, const Sint32 scrollState, const GameControllerState& gameControllerState)
 {
 	constexpr Sint16 ControllerAxisDeadZone = 8'000;
 
 	if (((mouseState.currentButtonStates & SDL_BUTTON(SDL_BUTTON_LEFT)) && !(mouseState.previousButtonStates & SDL_BUTTON(SDL_BUTTON_LEFT))) ||
 		(gameControllerState.currentAxes.triggerLeft > ControllerAxisDeadZone && gameControllerState.previousAxes.triggerLeft <= ControllerAxisDeadZone))
 	{
-		float depth = 0.0f;
-		glReadPixels(m_game.GetWindowSize().x / 2, m_game.GetWindowSize().y / 2, 1, 1, GL_DEPTH_COMPONENT, GL_FLOAT, &depth);
-
-		const glm::ivec3 clickPosition = glm::unProject(glm::vec3{ m_game.GetWindowSize().x / 2.0f, m_game.GetWindowSize().y / 2.0f, depth + 0.0001f }, m_camera.GetViewMatrix(), perspectiveMatrix, glm::vec4{ 0, 0, m_game.GetWindowSize() });
-		const unsigned int distance = static_cast<unsigned int>(glm::abs(glm::distance(m_camera.GetPosition(), glm::vec3(clickPosition))));
-		std::optional<Chunk*> chunk = GetChunkAt(clickPosition.x - clickPosition.x % Chunk::GetSize().x, clickPosition.y - clickPosition.y % Chunk::GetSize().y, clickPosition.z - clickPosition.z % Chunk::GetSize().z);
-
-		if (distance < 32 && chunk.has_value() && DestroyBlockAt(clickPosition.x, clickPosition.y, clickPosition.z))
+		if (const std::optional<RaycastHit> hit = Raycast(m_camera.GetPosition(), m_camera.GetFront(), s_BlockReachDistance);
+			hit.has_value() && DestroyBlockAt(hit->blockPosition.x, hit->blockPosition.y, hit->blockPosition.z))
 		{
 			m_blockSoundSource.SetVolume(1.0f);
-			m_blockSoundSource.SetPosition(clickPosition);
+			m_blockSoundSource.SetPosition(glm::vec3(hit->blockPosition));
 			m_blockSoundSource.Play(m_blockBreakSound);
-
-			chunk.value()->Create();
-
-			UpdateNearbyChunks(clickPosition);
 		}
 	}
 
 	if (((mouseState.currentButtonStates & SDL_BUTTON(SDL_BUTTON_RIGHT)) && !(mouseState.previousButtonStates & SDL_BUTTON(SDL_BUTTON_RIGHT))) ||
 		(gameControllerState.currentAxes.triggerRight > ControllerAxisDeadZone && gameControllerState.previousAxes.triggerRight <= ControllerAxisDeadZone))
 	{
-		float depth = 0.0f;
-		glReadPixels(m_game.GetWindowSize().x / 2, m_game.GetWindowSize().y / 2, 1, 1, GL_DEPTH_COMPONENT, GL_FLOAT, &depth);
-
-		const glm::ivec3 clickPosition = glm::unProject(glm::vec3{ m_game.GetWindowSize().x / 2.0f, m_game.GetWindowSize().y / 2.0f, depth - 0.0001f }, m_camera.GetViewMatrix(), perspectiveMatrix, glm::vec4{ 0, 0, m_game.GetWindowSize() });
-		const unsigned int distance = static_cast<unsigned int>(glm::abs(glm::distance(m_camera.GetPosition(), glm::vec3(clickPosition))));
-		std::optional<Chunk*> chunk = GetChunkAt(clickPosition.x - clickPosition.x % Chunk::GetSize().x, clickPosition.y - clickPosition.y % Chunk::GetSize().y, clickPosition.z - clickPosition.z % Chunk::GetSize().z);
-
-		if (distance < 32 && chunk.has_value() && PlaceBlockAt(clickPosition.x, clickPosition.y, clickPosition.z, m_selectedBlock))
+		if (const std::optional<RaycastHit> hit = Raycast(m_camera.GetPosition(), m_camera.GetFront(), s_BlockReachDistance);
+			hit.has_value() && hit->previousPosition != hit->blockPosition && PlaceBlockAt(hit->previousPosition.x, hit->previousPosition.y, hit->previousPosition.z, m_selectedBlock))
 		{
 			m_blockSoundSource.SetVolume(1.0f);
-			m_blockSoundSource.SetPosition(clickPosition);
+			m_blockSoundSource.SetPosition(glm::vec3(hit->previousPosition));
 			m_blockSoundSource.Play(m_blockPlaceSound);
-
-			chunk.value()->Create();
-
-			UpdateNearbyChunks(clickPosition);
 		}
 	}
 
@@ -130,12 +125,49 @@ void World::ProcessInput(const KeyboardState& keyboardState, const MouseState& m
 	}
 }
 
-void World::Render() const
+void World::Update()
+{
+	UpdateChunkStreaming();
+	RemeshDirtyChunks();
+	UploadChunkMeshes(s_MeshUploadTimeBudget);
+}
+
+void World::FlushChunkMeshes()
 {
+	m_workerThreads.WaitForJobs();
+	UploadChunkMeshes(std::chrono::steady_clock::duration::max());
+}
+
+void World::Render(const glm::mat4& viewProjectionMatrix) const
+{
+	const Frustum frustum(viewProjectionMatrix);
+	m_renderStatistics = RenderStatistics{ };
+	m_chunkDraws.clear();
+
 	for (const auto& [position, chunk] : m_chunks)
 	{
-		chunk->Render();
+		if (chunk->IsEmpty())
+		{
+			++m_renderStatistics.emptyChunkCount;
+
+			continue;
+		}
+
+		if (!frustum.IsBoxVisible(chunk->GetPosition(), chunk->GetPosition() + glm::vec3(Chunk::GetSize())))
+		{
+			++m_renderStatistics.culledChunkCount;
+
+			continue;
+		}
+
+		m_chunkDraws.push_back(chunk->GetMeshDraw());
+		++m_renderStatistics.visibleChunkCount;
 	}
+
+	RenderState::SetActiveTextureUnit(GL_TEXTURE0);
+	m_tileMap->Bind();
+
+	m_chunkMeshArena.Render(m_chunkDraws);
 }
 
 std::optional<Chunk*> World::GetChunkAt(const int x, const int y, const int z) const
@@ -153,139 +185,707 @@ std::optional<Chunk*> World::GetChunkAt(const int x, const int y, const int z) c
 	}
 }
 
-void World::AddTreeLocation(const int x, const int y, const int z)
+Block World::GetBlockAt(const glm::ivec3& position) const
 {
-	m_treeLocations.insert(glm::ivec3{ x, y, z });
+	const glm::ivec3 chunkPosition = WorldCoordinatesToChunkCoordinates(position.x, position.y, position.z);
+
+	if (const std::optional<Chunk*> chunk = GetChunkAt(chunkPosition.x, chunkPosition.y, chunkPosition.z);
+		chunk.has_value())
+	{
+		const glm::ivec3 localPosition = position - chunkPosition;
+
+		return chunk.value()->GetBlockAt(localPosition.x, localPosition.y, localPosition.z);
+	}
+
+	return Block::Air;
+}
+
+std::optional<World::RaycastHit> World::Raycast(const glm::vec3& origin, const glm::vec3& direction, const float maxDistance) const
+{
+	return Raycast(origin, direction, maxDistance, [this](const glm::ivec3& position)
+	{
+		return GetBlockAt(position);
+	});
 }
 
-bool World::PlaceBlockAt(int x, int y, int z, const Block block)
+std::optional<World::RaycastHit> World::Raycast(const glm::vec3& origin, const glm::vec3& direction, const float maxDistance, const std::function<Block(const glm::ivec3&)>& getBlock)
 {
-	std::optional<Chunk*> chunk = GetChunkAt(x - x % Chunk::GetSize().x, y - y % Chunk::GetSize().y, z - z % Chunk::GetSize().z);
+	if (glm::length(direction) == 0.0f)
+	{
+		return std::nullopt;
+	}
+
+	const glm::vec3 rayDirection = glm::normalize(direction);
+	constexpr float Infinity = std::numeric_limits<float>::infinity();
+
+	glm::ivec3 cell(glm::floor(origin));
+	glm::ivec3 previousCell = cell;
+	glm::ivec3 faceNormal{ 0, 0, 0 };
 
-	x %= Chunk::GetSize().x;
-	y %= Chunk::GetSize().y;
-	z %= Chunk::GetSize().z;
+	glm::ivec3 step{ 0, 0, 0 };
+	glm::vec3 nextBoundaryDistance{ Infinity, Infinity, Infinity };
+	glm::vec3 cellCrossingDistance{ Infinity, Infinity, Infinity };
 
-	if (chunk.has_value() && chunk.value()->GetBlockAt(x, y, z) == Block::Air)
+	for (glm::length_t axis = 0; axis < 3; ++axis)
 	{
-		chunk.value()->SetBlockAt(x, y, z, block);
+		if (rayDirection[axis] > 0.0f)
+		{
+			step[axis] = 1;
+			nextBoundaryDistance[axis] = (static_cast<float>(cell[axis] + 1) - origin[axis]) / rayDirection[axis];
+			cellCrossingDistance[axis] = 1.0f / rayDirection[axis];
+		}
+		else if (rayDirection[axis] < 0.0f)
+		{
+			step[axis] = -1;
+			nextBoundaryDistance[axis] = (origin[axis] - static_cast<float>(cell[axis])) / -rayDirection[axis];
+			cellCrossingDistance[axis] = 1.0f / -rayDirection[axis];
+		}
+	}
+
+	float distance = 0.0f;
+
+	while (distance <= maxDistance)
+	{
+		if (const Block block = getBlock(cell);
+			block != Block::Air)
+		{
+			return RaycastHit{ cell, previousCell, faceNormal, block, distance };
+		}
 
-		return true;
+		glm::length_t axis = 0;
+
+		if (nextBoundaryDistance.y < nextBoundaryDistance[axis])
+		{
+			axis = 1;
+		}
+
+		if (nextBoundaryDistance.z < nextBoundaryDistance[axis])
+		{
+			axis = 2;
+		}
+
+		previousCell = cell;
+		cell[axis] += step[axis];
+		distance = nextBoundaryDistance[axis];
+		nextBoundaryDistance[axis] += cellCrossingDistance[axis];
+
+		faceNormal = glm::ivec3{ 0, 0, 0 };
+		faceNormal[axis] = -step[axis];
 	}
 
-	return false;
+	return std::nullopt;
+}
+
+glm::ivec3 World::GetCameraChunkColumn() const
+{
+	const glm::ivec3 cameraPosition = glm::floor(m_camera.GetPosition());
+	const glm::ivec3 chunkPosition = WorldCoordinatesToChunkCoordinates(cameraPosition.x, cameraPosition.y, cameraPosition.z);
+
+	return glm::ivec3{ chunkPosition.x / static_cast<int>(Chunk::GetSize().x), 0, chunkPosition.z / static_cast<int>(Chunk::GetSize().z) };
+}
+
+int World::GetColumnDistanceSquared(const glm::ivec3& chunkPosition) const noexcept
+{
+	const int xDistance = chunkPosition.x / static_cast<int>(Chunk::GetSize().x) - m_streamingCentre.x;
+	const int zDistance = chunkPosition.z / static_cast<int>(Chunk::GetSize().z) - m_streamingCentre.z;
+
+	return xDistance * xDistance + zDistance * zDistance;
 }
 
-bool World::DestroyBlockAt(int x, int y, int z)
+std::vector<glm::ivec3> World::GetChunksWithinLoadRadius() const
 {
-	std::optional<Chunk*> chunk = GetChunkAt(x - x % Chunk::GetSize().x, y - y % Chunk::GetSize().y, z - z % Chunk::GetSize().z);
+	std::vector<glm::ivec3> chunkPositions;
+
+	for (int x = -m_chunkLoadRadius; x <= m_chunkLoadRadius; ++x)
+	{
+		for (int z = -m_chunkLoadRadius; z <= m_chunkLoadRadius; ++z)
+		{
+			if (x * x + z * z > m_chunkLoadRadius * m_chunkLoadRadius)
+			{
+				continue;
+			}
 
-	x %= Chunk::GetSize().x;
-	y %= Chunk::GetSize().y;
-	z %= Chunk::GetSize().z;
+			for (unsigned int y = 0; y < s_ChunkHeight; ++y)
+			{
+				chunkPositions.push_back(glm::ivec3{ m_streamingCentre.x + x, y, m_streamingCentre.z + z } * glm::ivec3(Chunk::GetSize()));
+			}
+		}
+	}
 
-	if (chunk.has_value() && chunk.value()->GetBlockAt(x, y, z) != Block::Air)
+	std::stable_sort(std::begin(chunkPositions), std::end(chunkPositions), [this](const glm::ivec3& lhs, const glm::ivec3& rhs)
 	{
-		chunk.value()->SetBlockAt(x, y, z, Block::Air);
+		return GetColumnDistanceSquared(lhs) < GetColumnDistanceSquared(rhs);
+	});
+
+	return chunkPositions;
+}
+
+size_t World::GetHeightmapCacheCapacity(const unsigned int chunkUnloadRadius) noexcept
+{
+	const size_t columnDiameter = 2 * static_cast<size_t>(chunkUnloadRadius) + 1;
+
+	return columnDiameter * columnDiameter;
+}
 
-		return true;
+size_t World::GetChunkMeshArenaCapacity(const unsigned int chunkLoadRadius) noexcept
+{
+	const size_t columnDiameter = 2 * static_cast<size_t>(chunkLoadRadius) + 1;
+
+	return columnDiameter * columnDiameter * s_ChunkHeight * s_ExpectedVerticesPerChunk;
+}
+
+void World::UpdateChunkStreaming()
+{
+	if (const glm::ivec3 cameraChunkColumn = GetCameraChunkColumn();
+		cameraChunkColumn != m_streamingCentre)
+	{
+		m_streamingCentre = cameraChunkColumn;
+		RefreshStreamingQueues();
 	}
 
-	return false;
+	IntegrateGeneratedChunks();
+	UnloadChunks();
+	LoadChunks();
 }
 
-void World::UpdateNearbyChunks(const glm::ivec3& position)
+void World::RefreshStreamingQueues()
 {
-	if (position.x % Chunk::GetSize().x == 0)
+	m_chunkLoadQueue.clear();
+
+	const std::vector<glm::ivec3> chunksWithinLoadRadius = GetChunksWithinLoadRadius();
+
+	for (auto chunkPosition = std::crbegin(chunksWithinLoadRadius); chunkPosition != std::crend(chunksWithinLoadRadius); ++chunkPosition)
 	{
-		std::optional<Chunk*> neighbourChunk = GetChunkAt(position.x - position.x % Chunk::GetSize().x - static_cast<int>(Chunk::GetSize().x), position.y - position.y % Chunk::GetSize().y, position.z - position.z % Chunk::GetSize().z);
+		if (m_chunks.find(*chunkPosition) == std::cend(m_chunks) && m_generatingChunks.find(*chunkPosition) == std::cend(m_generatingChunks))
+		{
+			m_chunkLoadQueue.push_back(*chunkPosition);
+		}
+	}
+
+	m_chunkUnloadQueue.clear();
 
-		if (neighbourChunk.has_value())
+	for (const auto& [position, chunk] : m_chunks)
+	{
+		if (!IsWithinRadius(position, m_chunkUnloadRadius))
 		{
-			neighbourChunk.value()->Create();
+			m_chunkUnloadQueue.push_back(position);
 		}
 	}
-	else if (position.x % Chunk::GetSize().x == Chunk::GetSize().x - 1)
+
+	std::sort(std::begin(m_chunkUnloadQueue), std::end(m_chunkUnloadQueue), [this](const glm::ivec3& lhs, const glm::ivec3& rhs)
 	{
-		std::optional<Chunk*> neighbourChunk = GetChunkAt(position.x - position.x % Chunk::GetSize().x + static_cast<int>(Chunk::GetSize().x), position.y - position.y % Chunk::GetSize().y, position.z - position.z % Chunk::GetSize().z);
+		return GetColumnDistanceSquared(lhs) < GetColumnDistanceSquared(rhs);
+	});
+}
+
+void World::IntegrateGeneratedChunks()
+{
+	std::queue<glm::ivec3> generatedChunks;
+
+	{
+		const std::lock_guard<std::mutex> lock(m_generatedChunkMutex);
+		std::swap(generatedChunks, m_generatedChunkQueue);
+	}
 
-		if (neighbourChunk.has_value())
+	if (generatedChunks.empty())
+	{
+		return;
+	}
+
+	while (!generatedChunks.empty())
+	{
+		const glm::ivec3 chunkPosition = generatedChunks.front();
+		generatedChunks.pop();
+
+		const auto location = m_generatingChunks.find(chunkPosition);
+		std::unique_ptr<Chunk> chunk = std::move(location->second);
+		m_generatingChunks.erase(location);
+
+		if (!IsWithinRadius(chunkPosition, m_chunkUnloadRadius))
 		{
-			neighbourChunk.value()->Create();
+			continue;
+		}
+
+		Chunk& integratedChunk = *m_chunks.insert({ chunkPosition, std::move(chunk) }).first->second;
+		m_dirtyChunks.insert(chunkPosition);
+
+		ApplyPendingStructureBlocks(integratedChunk, m_dirtyChunks);
+		PlaceStructureBlocks(integratedChunk, m_dirtyChunks);
+
+		const glm::ivec3 chunkSize = Chunk::GetSize();
+
+		for (glm::length_t axis = 0; axis < 3; ++axis)
+		{
+			glm::ivec3 offset{ 0, 0, 0 };
+			offset[axis] = chunkSize[axis];
+
+			m_dirtyChunks.insert(chunkPosition - offset);
+			m_dirtyChunks.insert(chunkPosition + offset);
 		}
 	}
+}
+
+void World::UnloadChunks()
+{
+	unsigned int unloadCount = 0;
 
-	if (position.y % Chunk::GetSize().y == 0)
+	while (unloadCount < m_chunkLoadsPerFrame && !m_chunkUnloadQueue.empty())
 	{
-		std::optional<Chunk*> neighbourChunk = GetChunkAt(position.x - position.x % Chunk::GetSize().x, position.y - position.y % Chunk::GetSize().y - static_cast<int>(Chunk::GetSize().y), position.z - position.z % Chunk::GetSize().z);
+		const glm::ivec3 chunkPosition = m_chunkUnloadQueue.back();
+		m_chunkUnloadQueue.pop_back();
 
-		if (neighbourChunk.has_value())
+		if (IsWithinRadius(chunkPosition, m_chunkUnloadRadius))
 		{
-			neighbourChunk.value()->Create();
+			continue;
+		}
+
+		if (const auto location = m_chunks.find(chunkPosition);
+			location != std::end(m_chunks))
+		{
+			SaveChunk(*location->second);
+			RemovePendingStructureBlocks(chunkPosition);
+			m_chunks.erase(location);
+
+			++unloadCount;
 		}
 	}
-	else if (position.y % Chunk::GetSize().y == Chunk::GetSize().y - 1)
+}
+
+void World::LoadChunks()
+{
+	unsigned int loadCount = 0;
+
+	while (loadCount < m_chunkLoadsPerFrame && m_generatingChunks.size() < m_chunkLoadsPerFrame * s_PendingChunkLoadFrames && !m_chunkLoadQueue.empty())
 	{
-		std::optional<Chunk*> neighbourChunk = GetChunkAt(position.x - position.x % Chunk::GetSize().x, position.y - position.y % Chunk::GetSize().y + static_cast<int>(Chunk::GetSize().y), position.z - position.z % Chunk::GetSize().z);
+		const glm::ivec3 chunkPosition = m_chunkLoadQueue.back();
+		m_chunkLoadQueue.pop_back();
 
-		if (neighbourChunk.has_value())
+		if (m_chunks.find(chunkPosition) != std::cend(m_chunks) || m_generatingChunks.find(chunkPosition) != std::cend(m_generatingChunks))
 		{
-			neighbourChunk.value()->Create();
+			continue;
 		}
+
+		std::unique_ptr<Chunk> chunk = std::make_unique<Chunk>(glm::vec3(chunkPosition), *this);
+
+		m_workerThreads.Enqueue([this, chunkPosition, currentChunk = chunk.get()]()
+		{
+			LoadOrGenerateChunk(*currentChunk);
+
+			const std::lock_guard<std::mutex> lock(m_generatedChunkMutex);
+			m_generatedChunkQueue.push(chunkPosition);
+		});
+
+		m_generatingChunks.insert({ chunkPosition, std::move(chunk) });
+		++loadCount;
 	}
+}
 
-	if (position.z % Chunk::GetSize().z == 0)
+void World::LoadOrGenerateChunk(Chunk& chunk)
+{
+	if (const std::optional<RegionFile::ChunkData> savedChunk = m_regionStorage.LoadChunk(chunk.GetIndex());
+		savedChunk.has_value())
 	{
-		std::optional<Chunk*> neighbourChunk = GetChunkAt(position.x - position.x % Chunk::GetSize().x, position.y - position.y % Chunk::GetSize().y, position.z - position.z % Chunk::GetSize().z - static_cast<int>(Chunk::GetSize().z));
+		chunk.LoadBlocks(savedChunk->blocks, savedChunk->appliedStructureSources);
+		chunk.GenerateStructureBlocks();
+	}
+	else
+	{
+		chunk.GenerateBlocks();
+	}
+}
+
+void World::SaveChunk(const Chunk& chunk)
+{
+	if (chunk.IsModified())
+	{
+		m_regionStorage.SaveChunk(chunk.GetIndex(), RegionFile::ChunkData{ chunk.GetBlocks().ToVector(), chunk.GetAppliedStructureSources() });
+	}
+}
 
-		if (neighbourChunk.has_value())
+void World::GenerateChunks()
+{
+	const auto startTime = std::chrono::steady_clock::now();
+
+	for (auto& [position, chunk] : m_chunks)
+	{
+		m_workerThreads.Enqueue([this, currentChunk = chunk.get()]()
 		{
-			neighbourChunk.value()->Create();
-		}
+			LoadOrGenerateChunk(*currentChunk);
+		});
+	}
+
+	m_workerThreads.WaitForJobs();
+
+	const std::chrono::duration<float, std::milli> generationTime = std::chrono::steady_clock::now() - startTime;
+
+	const HeightmapCache::Statistics heightmapStatistics = m_heightmapCache.GetStatistics();
+
+	std::ostringstream messageStream;
+	messageStream << "Generated " << m_chunks.size() << " chunks in " << generationTime.count() << "ms using " << m_workerThreads.GetWorkerCount() << " worker thread(s): " << heightmapStatistics.noiseEvaluationCount << " noise evaluations, " << heightmapStatistics.hitCount << " heightmap cache hits, " << heightmapStatistics.missCount << " misses.";
+
+	Logger::Log(messageStream.str());
+}
+
+void World::MeshChunks()
+{
+	const auto startTime = std::chrono::steady_clock::now();
+
+	for (auto& [position, chunk] : m_chunks)
+	{
+		QueueChunkMesh(*chunk);
 	}
-	else if (position.z % Chunk::GetSize().z == Chunk::GetSize().z - 1)
+
+	m_workerThreads.WaitForJobs();
+
+	const std::chrono::duration<float, std::milli> meshingTime = std::chrono::steady_clock::now() - startTime;
+
+	UploadChunkMeshes(std::chrono::steady_clock::duration::max());
+
+	size_t vertexCount = 0;
+	size_t vertexBufferSize = 0;
+
+	for (const auto& [position, chunk] : m_chunks)
+	{
+		vertexCount += chunk->GetVertexCount();
+		vertexBufferSize += chunk->GetVertexBufferSize();
+	}
+
+	const ChunkMeshArena::Statistics arenaStatistics = m_chunkMeshArena.GetStatistics();
+
+	std::ostringstream messageStream;
+	messageStream << "Meshed " << m_chunks.size() << " chunks (" << (m_meshingMode == Chunk::MeshingMode::Greedy ? "greedy" : "per-face") << ") in " << meshingTime.count() << "ms: " << vertexCount << " vertices in " << vertexBufferSize << " bytes of vertex buffers (" << vertexCount * sizeof(Vertex3D) << " bytes unpacked), sharing one " << m_quadElementBuffer.GetMemoryUsage() << "-byte quad element buffer.";
+	messageStream << " Chunk mesh arena: " << arenaStatistics.usedSize << "/" << arenaStatistics.capacity << " vertices in " << arenaStatistics.allocationCount << " allocations, " << arenaStatistics.freeBlockCount << " free blocks (" << arenaStatistics.fragmentation * 100.0f << "% fragmented), grown " << arenaStatistics.growthCount << " times.";
+
+	Logger::Log(messageStream.str());
+}
+
+void World::LogBlockMemoryUsage() const
+{
+	size_t memoryUsage = 0;
+	size_t uniformChunkCount = 0;
+
+	for (const auto& [position, chunk] : m_chunks)
 	{
-		std::optional<Chunk*> neighbourChunk = GetChunkAt(position.x - position.x % Chunk::GetSize().x, position.y - position.y % Chunk::GetSize().y, position.z - position.z % Chunk::GetSize().z + static_cast<int>(Chunk::GetSize().z));
+		memoryUsage += chunk->GetBlocks().GetMemoryUsage();
 
-		if (neighbourChunk.has_value())
+		if (chunk->GetBlocks().GetBitsPerBlock() == 0)
 		{
-			neighbourChunk.value()->Create();
+			++uniformChunkCount;
 		}
 	}
+
+	const size_t flatMemoryUsage = m_chunks.size() * BlockStorage::GetFlatMemoryUsage(Chunk::GetSize().x * Chunk::GetSize().y * Chunk::GetSize().z);
+
+	std::ostringstream messageStream;
+	messageStream << "Chunk block storage: " << memoryUsage << " bytes (" << memoryUsage / std::max<size_t>(m_chunks.size(), 1) << " bytes per chunk, " << uniformChunkCount << " uniform chunks); flat storage would use " << flatMemoryUsage << " bytes.";
+
+	Logger::Log(messageStream.str());
+
+	size_t pendingStructureBlockCount = 0;
+
+	for (const auto& [position, pendingBlocks] : m_pendingStructureBlocks)
+	{
+		pendingStructureBlockCount += pendingBlocks.size();
+	}
+
+	std::ostringstream pendingMessageStream;
+	pendingMessageStream << "Pending structure blocks: " << pendingStructureBlockCount << " blocks for " << m_pendingStructureBlocks.size() << " chunks in " << GetPendingStructureBlockMemoryUsage() << " bytes.";
+
+	Logger::Log(pendingMessageStream.str());
 }
 
-void World::CreateTree(const int x, const int y, const int z)
+void World::QueueChunkMesh(Chunk& chunk)
 {
-	constexpr int TreeHeight = 6;
+	m_workerThreads.Enqueue([this, snapshot = chunk.CreateMeshSnapshot(), &blockRegistry = m_blockRegistry, meshingMode = m_meshingMode]()
+	{
+		Chunk::MeshData meshData = Chunk::GenerateMesh(snapshot, blockRegistry, meshingMode);
+
+		const std::lock_guard<std::mutex> lock(m_meshUploadMutex);
+		m_meshUploadQueue.push(std::move(meshData));
+	});
+}
+
+void World::UploadChunkMeshes(const std::chrono::steady_clock::duration& timeBudget)
+{
+	const auto startTime = std::chrono::steady_clock::now();
 
-	for (int i = 0; i < TreeHeight; ++i)
+	do
 	{
-		PlaceBlockAt(x, y + i, z, Block::Log);
+		Chunk::MeshData meshData;
+
+		{
+			const std::lock_guard<std::mutex> lock(m_meshUploadMutex);
+
+			if (m_meshUploadQueue.empty())
+			{
+				break;
+			}
+
+			meshData = std::move(m_meshUploadQueue.front());
+			m_meshUploadQueue.pop();
+		}
+
+		if (std::optional<Chunk*> chunk = GetChunkAt(static_cast<int>(meshData.position.x), static_cast<int>(meshData.position.y), static_cast<int>(meshData.position.z));
+			chunk.has_value())
+		{
+			chunk.value()->UploadMesh(meshData, m_chunkMeshArena);
+		}
 	}
+	while (std::chrono::steady_clock::now() - startTime < timeBudget);
+}
 
-	constexpr int MinLeafHeight = 4;
-	constexpr int MaxLeafHeight = 8;
-	
-	int leafRadius = 3;
+bool World::SetBlock(const glm::ivec3& position, const Block block)
+{
+	return EditBlocks(position, position, [block](const Block) { return block; }) > 0;
+}
+
+size_t World::FillBlocks(const glm::ivec3& minPosition, const glm::ivec3& maxPosition, const Block block)
+{
+	return EditBlocks(minPosition, maxPosition, [block](const Block) { return block; });
+}
 
-	for (int i = MinLeafHeight; i <= MaxLeafHeight; ++i)
+size_t World::ReplaceBlocks(const glm::ivec3& minPosition, const glm::ivec3& maxPosition, const Block targetBlock, const Block replacementBlock)
+{
+	return EditBlocks(minPosition, maxPosition, [targetBlock, replacementBlock](const Block currentBlock) { return currentBlock == targetBlock ? replacementBlock : currentBlock; });
+}
+
+template <typename F>
+size_t World::EditBlocks(const glm::ivec3& minPosition, const glm::ivec3& maxPosition, const F& edit)
+{
+	const glm::ivec3 chunkSize = Chunk::GetSize();
+	const glm::ivec3 minChunkPosition = WorldCoordinatesToChunkCoordinates(minPosition.x, minPosition.y, minPosition.z);
+	const glm::ivec3 maxChunkPosition = WorldCoordinatesToChunkCoordinates(maxPosition.x, maxPosition.y, maxPosition.z);
+
+	size_t editedBlockCount = 0;
+
+	for (int chunkX = minChunkPosition.x; chunkX <= maxChunkPosition.x; chunkX += chunkSize.x)
 	{
-		for (int j = -leafRadius; j <= leafRadius; ++j)
+		for (int chunkY = minChunkPosition.y; chunkY <= maxChunkPosition.y; chunkY += chunkSize.y)
 		{
-			for (int k = -leafRadius; k <= leafRadius; ++k)
+			for (int chunkZ = minChunkPosition.z; chunkZ <= maxChunkPosition.z; chunkZ += chunkSize.z)
 			{
-				if (j == x && k == z)
+				const glm::ivec3 chunkPosition{ chunkX, chunkY, chunkZ };
+				std::optional<Chunk*> chunk = GetChunkAt(chunkPosition.x, chunkPosition.y, chunkPosition.z);
+
+				if (!chunk.has_value())
 				{
 					continue;
 				}
 
-				PlaceBlockAt(x + j, y + i, z + k, Block::Leaves);
+				const glm::ivec3 localMin = glm::max(minPosition - chunkPosition, glm::ivec3{ 0, 0, 0 });
+				const glm::ivec3 localMax = glm::min(maxPosition - chunkPosition, chunkSize - 1);
+
+				size_t chunkEditCount = 0;
+
+				for (int x = localMin.x; x <= localMax.x; ++x)
+				{
+					for (int y = localMin.y; y <= localMax.y; ++y)
+					{
+						for (int z = localMin.z; z <= localMax.z; ++z)
+						{
+							const Block currentBlock = chunk.value()->GetBlockAt(x, y, z);
+
+							if (const Block editedBlock = edit(currentBlock);
+								editedBlock != currentBlock)
+							{
+								chunk.value()->SetBlockAt(x, y, z, editedBlock);
+								++chunkEditCount;
+							}
+						}
+					}
+				}
+
+				if (chunkEditCount > 0)
+				{
+					chunk.value()->MarkAsModified();
+					MarkChunkDirty(chunkPosition, localMin, localMax);
+
+					editedBlockCount += chunkEditCount;
+				}
 			}
 		}
+	}
+
+	m_editStatistics.editedBlockCount += editedBlockCount;
+
+	return editedBlockCount;
+}
+
+void World::MarkChunkDirty(const glm::ivec3& chunkPosition, const glm::ivec3& localMin, const glm::ivec3& localMax)
+{
+	const glm::ivec3 chunkSize = Chunk::GetSize();
+	m_dirtyChunks.insert(chunkPosition);
+
+	for (glm::length_t axis = 0; axis < 3; ++axis)
+	{
+		glm::ivec3 offset{ 0, 0, 0 };
+		offset[axis] = chunkSize[axis];
+
+		if (localMin[axis] == 0)
+		{
+			m_dirtyChunks.insert(chunkPosition - offset);
+		}
+
+		if (localMax[axis] == chunkSize[axis] - 1)
+		{
+			m_dirtyChunks.insert(chunkPosition + offset);
+		}
+	}
+}
+
+void World::RemeshDirtyChunks()
+{
+	size_t remeshedChunkCount = 0;
+
+	for (const auto& chunkPosition : m_dirtyChunks)
+	{
+		if (std::optional<Chunk*> chunk = GetChunkAt(chunkPosition.x, chunkPosition.y, chunkPosition.z);
+			chunk.has_value())
+		{
+			QueueChunkMesh(*chunk.value());
+			++remeshedChunkCount;
+		}
+	}
+
+	m_dirtyChunks.clear();
+
+	m_lastEditStatistics = m_editStatistics;
+	m_lastEditStatistics.remeshedChunkCount = remeshedChunkCount;
+	m_editStatistics = EditStatistics{ };
+}
+
+bool World::PlaceBlockAt(const int x, const int y, const int z, const Block block)
+{
+	const glm::ivec3 position{ x, y, z };
+
+	return EditBlocks(position, position, [block](const Block currentBlock) { return currentBlock == Block::Air ? block : currentBlock; }) > 0;
+}
+
+bool World::DestroyBlockAt(const int x, const int y, const int z)
+{
+	return SetBlock(glm::ivec3{ x, y, z }, Block::Air);
+}
+
+void World::PlaceStructureBlocks(Chunk& chunk, std::unordered_set<glm::ivec3, ChunkPositionHash>& modifiedChunks)
+{
+	const glm::ivec3 sourcePosition = chunk.GetPosition();
+	std::unordered_set<glm::ivec3, ChunkPositionHash> targetChunkPositions;
+
+	for (const auto& [position, block] : chunk.ExtractStructureBlocks())
+	{
+		const glm::ivec3 chunkPosition = WorldCoordinatesToChunkCoordinates(position.x, position.y, position.z);
+
+		if (chunkPosition.y < 0 || chunkPosition.y >= static_cast<int>(s_ChunkHeight * Chunk::GetSize().y))
+		{
+			continue;
+		}
+
+		const glm::ivec3 localPosition = position - chunkPosition;
+		auto location = m_pendingStructureBlocks.find(chunkPosition);
 
-		if (i == MinLeafHeight + 1 || i == MinLeafHeight + 3)
+		if (location == std::end(m_pendingStructureBlocks))
 		{
-			--leafRadius;
+			location = m_pendingStructureBlocks.insert({ chunkPosition, std::vector<PendingStructureBlock>{ } }).first;
 		}
+
+		location->second.push_back(PendingStructureBlock{ glm::tvec3<std::uint8_t>(localPosition), GetNeighbourIndex(sourcePosition, chunkPosition), block });
+		targetChunkPositions.insert(chunkPosition);
 	}
+
+	for (const auto& targetChunkPosition : targetChunkPositions)
+	{
+		if (std::optional<Chunk*> targetChunk = GetChunkAt(targetChunkPosition.x, targetChunkPosition.y, targetChunkPosition.z);
+			targetChunk.has_value())
+		{
+			ApplyPendingStructureBlocks(*targetChunk.value(), modifiedChunks);
+		}
+	}
+}
+
+void World::ApplyPendingStructureBlocks(Chunk& chunk, std::unordered_set<glm::ivec3, ChunkPositionHash>& modifiedChunks)
+{
+	const auto location = m_pendingStructureBlocks.find(glm::ivec3(chunk.GetPosition()));
+
+	if (location == std::end(m_pendingStructureBlocks))
+	{
+		return;
+	}
+
+	std::uint32_t appliedSources = 0u;
+
+	for (const auto& pendingBlock : location->second)
+	{
+		if (chunk.HasAppliedStructureSource(pendingBlock.sourceIndex))
+		{
+			continue;
+		}
+
+		appliedSources |= 1u << pendingBlock.sourceIndex;
+		const glm::ivec3 localPosition(pendingBlock.localPosition);
+
+		if (Chunk::CanPlaceStructureBlock(chunk.GetBlockAt(localPosition.x, localPosition.y, localPosition.z), pendingBlock.block))
+		{
+			chunk.SetBlockAt(localPosition.x, localPosition.y, localPosition.z, pendingBlock.block);
+		}
+	}
+
+	if (appliedSources != 0u)
+	{
+		chunk.MarkStructureSourcesApplied(appliedSources);
+		modifiedChunks.insert(location->first);
+	}
+}
+
+void World::RemovePendingStructureBlocks(const glm::ivec3& sourcePosition)
+{
+	const glm::ivec3 chunkSize = Chunk::GetSize();
+
+	for (int x = -1; x <= 1; ++x)
+	{
+		for (int y = -1; y <= 1; ++y)
+		{
+			for (int z = -1; z <= 1; ++z)
+			{
+				const glm::ivec3 targetPosition = sourcePosition + glm::ivec3{ x, y, z } * chunkSize;
+				const auto location = m_pendingStructureBlocks.find(targetPosition);
+
+				if (location == std::end(m_pendingStructureBlocks))
+				{
+					continue;
+				}
+
+				const std::uint8_t sourceIndex = GetNeighbourIndex(sourcePosition, targetPosition);
+				std::vector<PendingStructureBlock>& pendingBlocks = location->second;
+
+				pendingBlocks.erase(std::remove_if(std::begin(pendingBlocks), std::end(pendingBlocks), [sourceIndex](const PendingStructureBlock& pendingBlock)
+				{
+					return pendingBlock.sourceIndex == sourceIndex;
+				}), std::end(pendingBlocks));
+
+				if (pendingBlocks.empty())
+				{
+					m_pendingStructureBlocks.erase(location);
+				}
+			}
+		}
+	}
+}
+
+std::uint8_t World::GetNeighbourIndex(const glm::ivec3& sourcePosition, const glm::ivec3& targetPosition) noexcept
+{
+	const glm::ivec3 offset = (sourcePosition - targetPosition) / glm::ivec3(Chunk::GetSize()) + glm::ivec3{ 1, 1, 1 };
+
+	return static_cast<std::uint8_t>(offset.x * 9 + offset.y * 3 + offset.z);
+}
+
+size_t World::GetPendingStructureBlockMemoryUsage() const noexcept
+{
+	size_t memoryUsage = m_pendingStructureBlocks.GetMemoryUsage();
+
+	for (const auto& [position, pendingBlocks] : m_pendingStructureBlocks)
+	{
+		memoryUsage += pendingBlocks.capacity() * sizeof(PendingStructureBlock);
+	}
+
+	return memoryUsage;
 }
\ No newline at end of file
@@ -7,43 +7,107 @@
 
 #include <glm/glm.hpp>
 
+#include <chrono>
+#include <cstdint>
 #include <functional>
 #include <memory>
+#include <mutex>
 #include <optional>
-#include <unordered_map>
+#include <queue>
 #include <unordered_set>
+#include <vector>
 
 #include "../../engine/audio/AudioSource.h"
 #include "../../engine/audio/Sound.h"
 #include "../../engine/camera/Camera3D.h"
+#include "../../engine/camera/Frustum.h"
+#include "../../engine/graphics/QuadElementBuffer.h"
 #include "../../engine/graphics/TileMap.h"
+#include "../../engine/utility/ThreadPool.h"
+#include "../../engine/utility/config/Config.h"
+#include "BlockRegistry.h"
 #include "Chunk.h"
+#include "ChunkMap.h"
+#include "ChunkMeshArena.h"
+#include "HeightmapCache.h"
+#include "RegionStorage.h"
 
-class Game;
-
-namespace std
+class World
+	: private INoncopyable, private INonmovable
 {
-	template <typename T>
-	struct hash<glm::tvec3<T>>
+public:
+	struct RenderStatistics
 	{
-		inline size_t operator() (const glm::tvec3<T>& vector) const noexcept { return (size_t(vector.x) << 1) + (size_t(vector.y) << 3) + (size_t(vector.z) << 5); }
+		size_t visibleChunkCount = 0;
+		size_t culledChunkCount = 0;
+		size_t emptyChunkCount = 0;
+	};
+
+	struct RaycastHit
+	{
+		glm::ivec3 blockPosition{ 0, 0, 0 };
+		glm::ivec3 previousPosition{ 0, 0, 0 };
+		glm::ivec3 faceNormal{ 0, 0, 0 };
+		Block block = Block::Air;
+		float distance = 0.0f;
+	};
+
+	struct EditStatistics
+	{
+		size_t editedBlockCount = 0;
+		size_t remeshedChunkCount = 0;
 	};
-}
 
-class World
-	: private INoncopyable, private INonmovable
-{
 private:
-	static constexpr int s_RenderDistance = 16;
-	static constexpr unsigned int s_ChunkHeight = 4u;
+	struct PendingStructureBlock
+	{
+		glm::tvec3<std::uint8_t> localPosition{ 0u, 0u, 0u };
+		std::uint8_t sourceIndex = 0u;
+		Block block = Block::Air;
+	};
 
-	const Game& m_game;
+	static constexpr unsigned int s_ChunkHeight = 4u;
+	static constexpr unsigned int s_PendingChunkLoadFrames = 4u;
+	static constexpr size_t s_ExpectedVerticesPerChunk = 2'048u;
+	static constexpr float s_BlockReachDistance = 32.0f;
+	static constexpr std::chrono::microseconds s_MeshUploadTimeBudget{ 2'000 };
 
 	const TileMap* m_tileMap = nullptr;
+	BlockRegistry m_blockRegistry;
+	RegionStorage m_regionStorage;
+	HeightmapCache m_heightmapCache;
 	const Camera3D& m_camera;
 
-	std::unordered_map<glm::ivec3, std::unique_ptr<Chunk>> m_chunks;
-	std::unordered_set<glm::ivec3> m_treeLocations;
+	QuadElementBuffer m_quadElementBuffer{ Chunk::GetMaxFaceCount() };
+	ChunkMeshArena m_chunkMeshArena;
+	ChunkMap<std::unique_ptr<Chunk>> m_chunks;
+	ChunkMap<std::unique_ptr<Chunk>> m_generatingChunks;
+
+	std::queue<glm::ivec3> m_generatedChunkQueue;
+	std::mutex m_generatedChunkMutex;
+
+	glm::ivec3 m_streamingCentre{ 0, 0, 0 };
+	int m_chunkLoadRadius = 0;
+	int m_chunkUnloadRadius = 0;
+	unsigned int m_chunkLoadsPerFrame = 0;
+
+	std::vector<glm::ivec3> m_chunkLoadQueue;
+	std::vector<glm::ivec3> m_chunkUnloadQueue;
+
+	ChunkMap<std::vector<PendingStructureBlock>> m_pendingStructureBlocks;
+
+	std::unordered_set<glm::ivec3, ChunkPositionHash> m_dirtyChunks;
+	EditStatistics m_editStatistics;
+	EditStatistics m_lastEditStatistics;
+
+	std::queue<Chunk::MeshData> m_meshUploadQueue;
+	std::mutex m_meshUploadMutex;
+
+	Chunk::MeshingMode m_meshingMode = Chunk::MeshingMode::PerFace;
+	ThreadPool m_workerThreads;
+
+	mutable RenderStatistics m_renderStatistics;
+	mutable std::vector<ChunkMeshArena::Draw> m_chunkDraws;
 
 	Block m_selectedBlock = Block::Planks;
 
@@ -54,25 +118,67 @@ private:
 
 public:
 	static glm::ivec3 WorldCoordinatesToChunkCoordinates(const int x, const int y, const int z);
+	static std::optional<RaycastHit> Raycast(const glm::vec3& origin, const glm::vec3& direction, const float maxDistance, const std::function<Block(const glm::ivec3&)>& getBlock);
 
-	World(const TileMap& tileMap, const Camera3D& camera, const Sound& breakSound, const Sound& placeSound, const Sound& switchSound, const Game& game);
-	~World() noexcept = default;
+	World(const TileMap& tileMap, const Camera3D& camera, const Sound& breakSound, const Sound& placeSound, const Sound& switchSound, const Config& config);
+	~World() noexcept;
 
-	void ProcessInput(const KeyboardState& keyboardState, const MouseState& mouseState, const Sint32 scrollState, const GameControllerState& gameControllerState, const glm::mat4& perspectiveMatrix);
-	void Render() const;
+	void ProcessInput(const KeyboardState& keyboardState, const MouseState& mouseState, const Sint32 scrollState, const GameControllerState& gameControllerState);
+	void Update();
+	void FlushChunkMeshes();
+	void Render(const glm::mat4& viewProjectionMatrix) const;
 
 	std::optional<Chunk*> GetChunkAt(const int x, const int y, const int z) const;
+	Block GetBlockAt(const glm::ivec3& position) const;
+	std::optional<RaycastHit> Raycast(const glm::vec3& origin, const glm::vec3& direction, const float maxDistance) const;
 
-	void AddTreeLocation(const int x, const int y, const int z);
+	bool SetBlock(const glm::ivec3& position, const Block block);
+	size_t FillBlocks(const glm::ivec3& minPosition, const glm::ivec3& maxPosition, const Block block);
+	size_t ReplaceBlocks(const glm::ivec3& minPosition, const glm::ivec3& maxPosition, const Block targetBlock, const Block replacementBlock);
 
+	inline unsigned int GetSeed() const noexcept { return m_regionStorage.GetSeed(); }
+	inline HeightmapCache& GetHeightmapCache() noexcept { return m_heightmapCache; }
 	inline Block GetSelectedBlock() const noexcept { return m_selectedBlock; }
+	inline const RenderStatistics& GetRenderStatistics() const noexcept { return m_renderStatistics; }
+	inline ChunkMeshArena::Statistics GetChunkMeshArenaStatistics() const noexcept { return m_chunkMeshArena.GetStatistics(); }
+	inline const EditStatistics& GetEditStatistics() const noexcept { return m_lastEditStatistics; }
 
 private:
-	bool PlaceBlockAt(int x, int y, int z, const Block block);
-	bool DestroyBlockAt(int x, int y, int z);
-	void UpdateNearbyChunks(const glm::ivec3& position);
-
-	void CreateTree(const int x, const int y, const int z);
+	glm::ivec3 GetCameraChunkColumn() const;
+	int GetColumnDistanceSquared(const glm::ivec3& chunkPosition) const noexcept;
+	inline bool IsWithinRadius(const glm::ivec3& chunkPosition, const int radius) const noexcept { return GetColumnDistanceSquared(chunkPosition) <= radius * radius; }
+	std::vector<glm::ivec3> GetChunksWithinLoadRadius() const;
+	static size_t GetHeightmapCacheCapacity(const unsigned int chunkUnloadRadius) noexcept;
+	static size_t GetChunkMeshArenaCapacity(const unsigned int chunkLoadRadius) noexcept;
+
+	void UpdateChunkStreaming();
+	void RefreshStreamingQueues();
+	void IntegrateGeneratedChunks();
+	void UnloadChunks();
+	void LoadChunks();
+
+	void LoadOrGenerateChunk(Chunk& chunk);
+	void SaveChunk(const Chunk& chunk);
+
+	void GenerateChunks();
+	void MeshChunks();
+	void LogBlockMemoryUsage() const;
+	void QueueChunkMesh(Chunk& chunk);
+	void UploadChunkMeshes(const std::chrono::steady_clock::duration& timeBudget);
+
+	template <typename F>
+	size_t EditBlocks(const glm::ivec3& minPosition, const glm::ivec3& maxPosition, const F& edit);
+	void MarkChunkDirty(const glm::ivec3& chunkPosition, const glm::ivec3& localMin, const glm::ivec3& localMax);
+	void RemeshDirtyChunks();
+
+	bool PlaceBlockAt(const int x, const int y, const int z, const Block block);
+	bool DestroyBlockAt(const int x, const int y, const int z);
+
+	void PlaceStructureBlocks(Chunk& chunk, std::unordered_set<glm::ivec3, ChunkPositionHash>& modifiedChunks);
+	void ApplyPendingStructureBlocks(Chunk& chunk, std::unordered_set<glm::ivec3, ChunkPositionHash>& modifiedChunks);
+	void RemovePendingStructureBlocks(const glm::ivec3& sourcePosition);
+	static std::uint8_t GetNeighbourIndex(const glm::ivec3& sourcePosition, const glm::ivec3& targetPosition) noexcept;
+	size_t GetPendingStructureBlockMemoryUsage() const noexcept;
 };
 
 #endif
\ No newline at end of file
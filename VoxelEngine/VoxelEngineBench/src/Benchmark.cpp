@@ -0,0 +1,53 @@
+#include "Benchmark.h"
+
+#include <algorithm>
+#include <cstdlib>
+#include <exception>
+#include <iostream>
+#include <iterator>
+
+bool Benchmark::Register(const std::string_view name, const Function function)
+{
+	GetCases().push_back(Case{ name, function });
+
+	return true;
+}
+
+int Benchmark::RunAll(const std::vector<std::string_view>& filters)
+{
+	bool hasFailed = false;
+
+	for (const auto& [name, function] : GetCases())
+	{
+		if (!filters.empty() && std::find(std::cbegin(filters), std::cend(filters), name) == std::cend(filters))
+		{
+			continue;
+		}
+
+		std::cout << name << std::endl;
+
+		try
+		{
+			function();
+		}
+		catch (const std::exception& error)
+		{
+			hasFailed = true;
+			std::cout << "    failed: " << error.what() << std::endl;
+		}
+	}
+
+	return hasFailed ? EXIT_FAILURE : EXIT_SUCCESS;
+}
+
+void Benchmark::Report(const std::string& result)
+{
+	std::cout << "    " << result << std::endl;
+}
+
+std::vector<Benchmark::Case>& Benchmark::GetCases()
+{
+	static std::vector<Case> cases;
+
+	return cases;
+}
\ No newline at end of file
@@ -0,0 +1,65 @@
+#pragma once
+#ifndef BENCHMARK_H
+#define BENCHMARK_H
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <limits>
+#include <string>
+#include <string_view>
+#include <vector>
+
+class Benchmark
+{
+public:
+	using Function = void(*)();
+
+private:
+	struct Case
+	{
+		std::string_view name;
+		Function function;
+	};
+
+	inline static volatile size_t s_sink = 0;
+
+public:
+	Benchmark() = delete;
+	~Benchmark() noexcept = delete;
+
+	static bool Register(const std::string_view name, const Function function);
+	static int RunAll(const std::vector<std::string_view>& filters);
+
+	static void Report(const std::string& result);
+	static void Consume(const size_t value) noexcept { s_sink = s_sink + value; }
+
+	template <typename F>
+	static double MeasureMilliseconds(F&& function)
+	{
+		const auto startTime = std::chrono::steady_clock::now();
+		function();
+
+		return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - startTime).count();
+	}
+
+	template <typename F>
+	static double MeasureBestMilliseconds(const unsigned int repetitionCount, F&& function)
+	{
+		double bestTime = std::numeric_limits<double>::infinity();
+
+		for (unsigned int i = 0; i < repetitionCount; ++i)
+		{
+			bestTime = std::min(bestTime, MeasureMilliseconds(function));
+		}
+
+		return bestTime;
+	}
+
+private:
+	static std::vector<Case>& GetCases();
+};
+
+#define BENCHMARK(name) static void name(); static const bool name##IsRegistered = Benchmark::Register(#name, name); static void name()
+
+#endif
\ No newline at end of file
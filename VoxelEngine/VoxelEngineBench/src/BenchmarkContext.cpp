@@ -0,0 +1,213 @@
+#include "BenchmarkContext.h"
+
+#include <glad/glad.h>
+#include <glm/gtc/matrix_transform.hpp>
+#include <SDL2/SDL.h>
+#include <stb_image/stb_image.h>
+
+#include <filesystem>
+#include <initializer_list>
+#include <optional>
+#include <sstream>
+#include <string_view>
+#include <system_error>
+#include <vector>
+
+#include "../../VoxelEngine/src/engine/error/GameException.h"
+#include "../../VoxelEngine/src/engine/graphics/RenderState.h"
+#include "../../VoxelEngine/src/engine/graphics/shaders/Shader.h"
+
+BenchmarkContext& BenchmarkContext::Get()
+{
+	static BenchmarkContext context;
+
+	return context;
+}
+
+std::string BenchmarkContext::GetGamePath(const std::string& path)
+{
+	return s_gameDirectory + path;
+}
+
+Config BenchmarkContext::CreateConfig(const unsigned int chunkLoadRadius, const unsigned int workerThreadCount)
+{
+	Config config;
+	config.workerThreadCount = workerThreadCount;
+	config.enableGreedyMeshing = true;
+	config.chunkLoadRadius = chunkLoadRadius;
+	config.chunkUnloadRadius = chunkLoadRadius + 2u;
+	config.saveDirectory = GetSaveDirectory("world");
+
+	return config;
+}
+
+std::string BenchmarkContext::GetSaveDirectory(const std::string& name)
+{
+	return s_saveDirectory + "/" + name;
+}
+
+void BenchmarkContext::RemoveSaves()
+{
+	std::error_code errorCode;
+	std::filesystem::remove_all(s_saveDirectory, errorCode);
+}
+
+std::vector<Chunk::MeshSnapshot> BenchmarkContext::CreateMeshSnapshots(const World& world, const int chunkLoadRadius)
+{
+	std::vector<Chunk::MeshSnapshot> snapshots;
+
+	for (int x = -chunkLoadRadius; x <= chunkLoadRadius; ++x)
+	{
+		for (int z = -chunkLoadRadius; z <= chunkLoadRadius; ++z)
+		{
+			for (int y = 0; y < s_ChunkLayerCount; ++y)
+			{
+				const glm::ivec3 chunkPosition = glm::ivec3{ x, y, z } * glm::ivec3(Chunk::GetSize());
+
+				if (const std::optional<Chunk*> chunk = world.GetChunkAt(chunkPosition.x, chunkPosition.y, chunkPosition.z);
+					chunk.has_value())
+				{
+					snapshots.push_back(chunk.value()->CreateMeshSnapshot());
+				}
+			}
+		}
+	}
+
+	return snapshots;
+}
+
+BenchmarkContext::BenchmarkContext()
+{
+	RemoveSaves();
+
+	InitialiseWindow();
+	InitialiseOpenGL();
+	m_audioContext = std::make_unique<AudioContext>();
+
+	LoadAssets();
+}
+
+BenchmarkContext::~BenchmarkContext() noexcept
+{
+	m_frameUniformBuffer = nullptr;
+	m_spriteShader = nullptr;
+	m_chunkShader = nullptr;
+
+	m_blockSound = nullptr;
+	m_blockTileMap = nullptr;
+	m_blockTextures = nullptr;
+
+	m_audioContext = nullptr;
+	m_window = nullptr;
+
+	SDL_Quit();
+}
+
+std::unique_ptr<World> BenchmarkContext::CreateWorld(const Config& config, const Camera3D& camera) const
+{
+	return std::make_unique<World>(*m_blockTileMap, camera, *m_blockSound, *m_blockSound, *m_blockSound, config);
+}
+
+void BenchmarkContext::RenderWorld(const World& world, const Camera3D& camera) const
+{
+	constexpr float NearPlane = 0.1f;
+	constexpr float FarPlane = 1000.0f;
+
+	FrameUniforms frameUniforms = CreateFrameUniforms();
+	frameUniforms.view = camera.GetViewMatrix();
+	frameUniforms.projection = glm::perspective(glm::radians(camera.GetZoom()), static_cast<float>(m_window->GetSize().x) / static_cast<float>(m_window->GetSize().y), NearPlane, FarPlane);
+	frameUniforms.viewProjection = frameUniforms.projection * frameUniforms.view;
+	frameUniforms.cameraPosition = camera.GetPosition();
+	m_frameUniformBuffer->SetData(frameUniforms);
+
+	glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
+
+	m_chunkShader->Use();
+	world.Render(frameUniforms.viewProjection);
+}
+
+std::unique_ptr<SpriteBatch> BenchmarkContext::CreateSpriteBatch(const size_t spritesPerRegion) const
+{
+	return std::make_unique<SpriteBatch>(*m_spriteShader, spritesPerRegion);
+}
+
+void BenchmarkContext::BeginOverlayFrame() const
+{
+	m_frameUniformBuffer->SetData(CreateFrameUniforms());
+
+	glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
+}
+
+void BenchmarkContext::EndFrame() const
+{
+	m_window->SwapBuffers();
+}
+
+void BenchmarkContext::InitialiseWindow()
+{
+	constexpr int SDLSuccess = 0;
+
+	if (SDL_Init(SDL_INIT_VIDEO) != SDLSuccess)
+	{
+		std::ostringstream errorMessageStream;
+		errorMessageStream << "Failed to initialise SDL: " << SDL_GetError();
+
+		throw GameException(GameException::Initialise::SDL, errorMessageStream.str());
+	}
+
+	SDL_GL_SetAttribute(SDL_GL_CONTEXT_MAJOR_VERSION, 4);
+	SDL_GL_SetAttribute(SDL_GL_CONTEXT_MINOR_VERSION, 6);
+	SDL_GL_SetAttribute(SDL_GL_CONTEXT_PROFILE_MASK, SDL_GL_CONTEXT_PROFILE_CORE);
+
+	m_window = std::make_unique<GLWindow>("Voxel Engine Benchmark", SDL_Rect{ SDL_WINDOWPOS_UNDEFINED, SDL_WINDOWPOS_UNDEFINED, 1280, 720 }, 0u, SDL_WINDOW_HIDDEN | SDL_WINDOW_OPENGL);
+	m_window->MakeCurrentContext();
+
+	if (!gladLoadGLLoader(static_cast<GLADloadproc>(SDL_GL_GetProcAddress)))
+	{
+		std::ostringstream errorMessageStream;
+		errorMessageStream << "Failed to initialise GLAD.";
+
+		throw GameException(GameException::Initialise::GLAD, errorMessageStream.str());
+	}
+
+	SDL_GL_SetSwapInterval(0);
+}
+
+void BenchmarkContext::InitialiseOpenGL() const
+{
+	RenderState::SetCapability(GL_DEPTH_TEST, true);
+	glDepthFunc(GL_LEQUAL);
+
+	RenderState::SetCapability(GL_CULL_FACE, true);
+	glCullFace(GL_BACK);
+	glFrontFace(GL_CCW);
+
+	glViewport(0, 0, m_window->GetSize().x, m_window->GetSize().y);
+}
+
+void BenchmarkContext::LoadAssets()
+{
+	stbi_set_flip_vertically_on_load(true);
+
+	m_blockTextures = std::make_unique<TextureArray>(GetGamePath("assets/textures/blocks.png"), glm::uvec2{ 16, 16 });
+	m_blockTileMap = std::make_unique<TileMap>(*m_blockTextures, glm::uvec2{ 16, 16 }, std::vector<std::string_view>{ "stone", "dirt", "grass_top", "grass_side", "bedrock", "log_top", "log_side", "leaves", "planks", "cobblestone", "glass", "pumpkin_bottom", "pumpkin_top", "pumpkin_side" });
+	m_blockSound = std::make_unique<Sound>(GetGamePath("assets/sounds/place.wav"));
+
+	m_chunkShader = std::make_unique<ShaderProgram>(std::initializer_list<Shader>{ Shader(Shader::Type::Vertex, GetGamePath("shaders/chunk.vert")), Shader(Shader::Type::Fragment, GetGamePath("shaders/chunk.frag")) });
+	m_chunkShader->Use();
+	m_chunkShader->SetTextureUniform("u_BlockTexture", 0);
+
+	m_spriteShader = std::make_unique<ShaderProgram>(std::initializer_list<Shader>{ Shader(Shader::Type::Vertex, GetGamePath("shaders/sprite_batch.vert")), Shader(Shader::Type::Fragment, GetGamePath("shaders/sprite_batch.frag")) });
+	m_spriteShader->Use();
+	m_spriteShader->SetTextureUniform("u_SpriteTexture", 0);
+
+	m_frameUniformBuffer = std::make_unique<UniformBuffer>(FrameUniforms::s_BindingPoint, sizeof(FrameUniforms));
+}
+
+FrameUniforms BenchmarkContext::CreateFrameUniforms() const
+{
+	FrameUniforms frameUniforms;
+	frameUniforms.orthographicProjection = glm::ortho(0.0f, static_cast<float>(m_window->GetSize().x), static_cast<float>(m_window->GetSize().y), 0.0f);
+
+	return frameUniforms;
+}
\ No newline at end of file
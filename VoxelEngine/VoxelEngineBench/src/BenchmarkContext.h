@@ -0,0 +1,100 @@
+#pragma once
+#ifndef BENCHMARK_CONTEXT_H
+#define BENCHMARK_CONTEXT_H
+
+#include "../../VoxelEngine/src/engine/interfaces/INoncopyable.h"
+#include "../../VoxelEngine/src/engine/interfaces/INonmovable.h"
+
+#include <glad/glad.h>
+#include <glm/glm.hpp>
+
+#include <cstddef>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "../../VoxelEngine/src/engine/audio/AudioContext.h"
+#include "../../VoxelEngine/src/engine/audio/Sound.h"
+#include "../../VoxelEngine/src/engine/camera/Camera3D.h"
+#include "../../VoxelEngine/src/engine/graphics/SpriteBatch.h"
+#include "../../VoxelEngine/src/engine/graphics/TextureArray.h"
+#include "../../VoxelEngine/src/engine/graphics/TileMap.h"
+#include "../../VoxelEngine/src/engine/graphics/shaders/FrameUniforms.h"
+#include "../../VoxelEngine/src/engine/graphics/shaders/ShaderProgram.h"
+#include "../../VoxelEngine/src/engine/graphics/shaders/UniformBuffer.h"
+#include "../../VoxelEngine/src/engine/graphics/window/GLWindow.h"
+#include "../../VoxelEngine/src/engine/utility/config/Config.h"
+#include "../../VoxelEngine/src/voxel_engine/world/Chunk.h"
+#include "../../VoxelEngine/src/voxel_engine/world/World.h"
+
+// Creates a hidden OpenGL window, the audio device and the block assets so that benchmarks can build real worlds.
+// Assets are read from the game's directory and saves go to a benchmark directory that is cleared on startup.
+class BenchmarkContext
+	: private INoncopyable, private INonmovable
+{
+private:
+	inline static const std::string s_gameDirectory = "../VoxelEngine/";
+	inline static const std::string s_saveDirectory = "benchmark_saves";
+
+	// Matches the number of chunk layers that the world loads in every column.
+	static constexpr int s_ChunkLayerCount = 4;
+
+	std::unique_ptr<GLWindow> m_window = nullptr;
+	std::unique_ptr<AudioContext> m_audioContext = nullptr;
+
+	std::unique_ptr<TextureArray> m_blockTextures = nullptr;
+	std::unique_ptr<TileMap> m_blockTileMap = nullptr;
+	std::unique_ptr<Sound> m_blockSound = nullptr;
+
+	std::unique_ptr<ShaderProgram> m_chunkShader = nullptr;
+	std::unique_ptr<ShaderProgram> m_spriteShader = nullptr;
+	std::unique_ptr<UniformBuffer> m_frameUniformBuffer = nullptr;
+
+public:
+	static BenchmarkContext& Get();
+
+	static std::string GetGamePath(const std::string& path);
+	static Config CreateConfig(const unsigned int chunkLoadRadius, const unsigned int workerThreadCount = 0u);
+	static std::string GetSaveDirectory(const std::string& name);
+	static void RemoveSaves();
+	static std::vector<Chunk::MeshSnapshot> CreateMeshSnapshots(const World& world, const int chunkLoadRadius);
+
+	BenchmarkContext();
+	~BenchmarkContext() noexcept;
+
+	std::unique_ptr<World> CreateWorld(const Config& config, const Camera3D& camera) const;
+	void RenderWorld(const World& world, const Camera3D& camera) const;
+
+	std::unique_ptr<SpriteBatch> CreateSpriteBatch(const size_t spritesPerRegion) const;
+	void BeginOverlayFrame() const;
+	void EndFrame() const;
+
+	template <typename F>
+	double MeasureGPUMilliseconds(F&& function) const
+	{
+		GLuint query = 0;
+		glGenQueries(1, &query);
+
+		glBeginQuery(GL_TIME_ELAPSED, query);
+		function();
+		glEndQuery(GL_TIME_ELAPSED);
+
+		GLuint64 elapsedTime = 0;
+		glGetQueryObjectui64v(query, GL_QUERY_RESULT, &elapsedTime);
+		glDeleteQueries(1, &query);
+
+		return static_cast<double>(elapsedTime) / 1'000'000.0;
+	}
+
+	inline const TileMap& GetBlockTileMap() const noexcept { return *m_blockTileMap; }
+	inline const GLWindow& GetWindow() const noexcept { return *m_window; }
+
+private:
+	void InitialiseWindow();
+	void InitialiseOpenGL() const;
+	void LoadAssets();
+
+	FrameUniforms CreateFrameUniforms() const;
+};
+
+#endif
\ No newline at end of file
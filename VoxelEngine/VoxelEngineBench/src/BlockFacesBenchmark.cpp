@@ -0,0 +1,146 @@
+#include <glm/glm.hpp>
+
+#include <cstddef>
+#include <iomanip>
+#include <memory>
+#include <sstream>
+#include <vector>
+
+#include "../../VoxelEngine/src/engine/camera/Camera3D.h"
+#include "../../VoxelEngine/src/voxel_engine/world/Block.h"
+#include "../../VoxelEngine/src/voxel_engine/world/Chunk.h"
+#include "../../VoxelEngine/src/voxel_engine/world/World.h"
+#include "Benchmark.h"
+#include "BenchmarkContext.h"
+
+static constexpr glm::tvec3<size_t> s_ChunkSize = Chunk::GetSize();
+static constexpr int s_ChunkLoadRadius = 8;
+static constexpr unsigned int s_RepetitionCount = 10u;
+
+// The per-neighbour face search that Chunk::GetBlockFaces replaced, kept as the baseline for its row masks.
+static std::vector<unsigned char> GetReferenceBlockFaces(const Chunk::MeshSnapshot& snapshot, size_t& faceCount)
+{
+	const auto getBlockIndex = [](const size_t x, const size_t y, const size_t z)
+	{
+		return x * s_ChunkSize.y * s_ChunkSize.z + y * s_ChunkSize.z + z;
+	};
+
+	const auto isNeighbourTransparent = [&snapshot](const size_t neighbourIndex, const size_t sliceIndex)
+	{
+		return snapshot.neighbourSlices[neighbourIndex].empty() || IsTransparent(snapshot.neighbourSlices[neighbourIndex][sliceIndex]);
+	};
+
+	faceCount = 0;
+	std::vector<unsigned char> blockFaces(s_ChunkSize.x * s_ChunkSize.y * s_ChunkSize.z, 0);
+	size_t currentIndex = 0;
+
+	for (size_t x = 0; x < s_ChunkSize.x; ++x)
+	{
+		for (size_t y = 0; y < s_ChunkSize.y; ++y)
+		{
+			for (size_t z = 0; z < s_ChunkSize.z; ++z)
+			{
+				if (snapshot.blocks[currentIndex] == Block::Air)
+				{
+					++currentIndex;
+
+					continue;
+				}
+
+				if ((x == 0 && isNeighbourTransparent(0, y * s_ChunkSize.z + z)) || (x != 0 && IsTransparent(snapshot.blocks[getBlockIndex(x - 1, y, z)])))
+				{
+					blockFaces[currentIndex] |= Direction::West;
+					++faceCount;
+				}
+
+				if ((x == s_ChunkSize.x - 1 && isNeighbourTransparent(1, y * s_ChunkSize.z + z)) || (x != s_ChunkSize.x - 1 && IsTransparent(snapshot.blocks[getBlockIndex(x + 1, y, z)])))
+				{
+					blockFaces[currentIndex] |= Direction::East;
+					++faceCount;
+				}
+
+				if ((y == 0 && isNeighbourTransparent(2, x * s_ChunkSize.z + z)) || (y != 0 && IsTransparent(snapshot.blocks[getBlockIndex(x, y - 1, z)])))
+				{
+					blockFaces[currentIndex] |= Direction::Nadir;
+					++faceCount;
+				}
+
+				if ((y == s_ChunkSize.y - 1 && isNeighbourTransparent(3, x * s_ChunkSize.z + z)) || (y != s_ChunkSize.y - 1 && IsTransparent(snapshot.blocks[getBlockIndex(x, y + 1, z)])))
+				{
+					blockFaces[currentIndex] |= Direction::Zenith;
+					++faceCount;
+				}
+
+				if ((z == 0 && isNeighbourTransparent(4, x * s_ChunkSize.y + y)) || (z != 0 && IsTransparent(snapshot.blocks[getBlockIndex(x, y, z - 1)])))
+				{
+					blockFaces[currentIndex] |= Direction::North;
+					++faceCount;
+				}
+
+				if ((z == s_ChunkSize.z - 1 && isNeighbourTransparent(5, x * s_ChunkSize.y + y)) || (z != s_ChunkSize.z - 1 && IsTransparent(snapshot.blocks[getBlockIndex(x, y, z + 1)])))
+				{
+					blockFaces[currentIndex] |= Direction::South;
+					++faceCount;
+				}
+
+				++currentIndex;
+			}
+		}
+	}
+
+	return blockFaces;
+}
+
+template <typename F>
+static void ReportFaceThroughput(const char* const name, const std::vector<Chunk::MeshSnapshot>& snapshots, const F& getBlockFaces)
+{
+	size_t faceCount = 0;
+
+	const double time = Benchmark::MeasureBestMilliseconds(s_RepetitionCount, [&]()
+	{
+		faceCount = 0;
+
+		for (const auto& snapshot : snapshots)
+		{
+			size_t chunkFaceCount = 0;
+			Benchmark::Consume(getBlockFaces(snapshot, chunkFaceCount).size());
+
+			faceCount += chunkFaceCount;
+		}
+	});
+
+	std::ostringstream resultStream;
+	resultStream << std::fixed << std::setprecision(2) << name << faceCount << " faces in " << snapshots.size() << " chunks, " << time << "ms, " << static_cast<double>(faceCount) / time / 1'000.0 << " million faces per second";
+
+	Benchmark::Report(resultStream.str());
+}
+
+BENCHMARK(BlockFaces)
+{
+	const BenchmarkContext& context = BenchmarkContext::Get();
+	const Camera3D camera{ glm::vec3{ 0.0f, 48.0f, 0.0f } };
+
+	const std::unique_ptr<World> world = context.CreateWorld(BenchmarkContext::CreateConfig(static_cast<unsigned int>(s_ChunkLoadRadius)), camera);
+	const std::vector<Chunk::MeshSnapshot> snapshots = BenchmarkContext::CreateMeshSnapshots(*world, s_ChunkLoadRadius);
+
+	size_t mismatchedChunkCount = 0;
+
+	for (const auto& snapshot : snapshots)
+	{
+		size_t faceCount = 0;
+		size_t referenceFaceCount = 0;
+
+		if (Chunk::GetBlockFaces(snapshot, faceCount) != GetReferenceBlockFaces(snapshot, referenceFaceCount) || faceCount != referenceFaceCount)
+		{
+			++mismatchedChunkCount;
+		}
+	}
+
+	ReportFaceThroughput("per-neighbour: ", snapshots, GetReferenceBlockFaces);
+	ReportFaceThroughput("row masks:     ", snapshots, Chunk::GetBlockFaces);
+
+	std::ostringstream resultStream;
+	resultStream << mismatchedChunkCount << " chunk(s) with face output that differs from the per-neighbour search";
+
+	Benchmark::Report(resultStream.str());
+}
\ No newline at end of file
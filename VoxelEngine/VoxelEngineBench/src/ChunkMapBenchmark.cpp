@@ -0,0 +1,109 @@
+#include <glm/glm.hpp>
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <initializer_list>
+#include <iomanip>
+#include <sstream>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "../../VoxelEngine/src/voxel_engine/world/Chunk.h"
+#include "../../VoxelEngine/src/voxel_engine/world/ChunkMap.h"
+#include "Benchmark.h"
+
+static constexpr int s_ChunkLayerCount = 4;
+static constexpr unsigned int s_PassCount = 20u;
+static constexpr unsigned int s_RepetitionCount = 3u;
+
+// The shift-and-add hash that World used for its chunk unordered_map before ChunkPositionHash.
+struct ReferenceChunkPositionHash
+{
+	inline size_t operator ()(const glm::ivec3& position) const noexcept { return (size_t(position.x) << 1) + (size_t(position.y) << 3) + (size_t(position.z) << 5); }
+};
+
+static std::vector<glm::ivec3> GetChunkPositions(const int chunkLoadRadius)
+{
+	std::vector<glm::ivec3> chunkPositions;
+
+	for (int x = -chunkLoadRadius; x <= chunkLoadRadius; ++x)
+	{
+		for (int z = -chunkLoadRadius; z <= chunkLoadRadius; ++z)
+		{
+			for (int y = 0; y < s_ChunkLayerCount; ++y)
+			{
+				chunkPositions.push_back(glm::ivec3{ x, y, z } * glm::ivec3(Chunk::GetSize()));
+			}
+		}
+	}
+
+	return chunkPositions;
+}
+
+// Looks up every chunk and its six neighbours, as meshing and block edits do.
+template <typename Map>
+static double MeasureLookupNanoseconds(const Map& chunks, const std::vector<glm::ivec3>& chunkPositions)
+{
+	const glm::ivec3 chunkSize(Chunk::GetSize());
+	const std::array<glm::ivec3, 7u> offsets{ glm::ivec3{ 0, 0, 0 }, glm::ivec3{ -chunkSize.x, 0, 0 }, glm::ivec3{ chunkSize.x, 0, 0 }, glm::ivec3{ 0, -chunkSize.y, 0 }, glm::ivec3{ 0, chunkSize.y, 0 }, glm::ivec3{ 0, 0, -chunkSize.z }, glm::ivec3{ 0, 0, chunkSize.z } };
+
+	const double time = Benchmark::MeasureBestMilliseconds(s_RepetitionCount, [&]()
+	{
+		size_t foundCount = 0;
+
+		for (unsigned int pass = 0; pass < s_PassCount; ++pass)
+		{
+			for (const glm::ivec3& chunkPosition : chunkPositions)
+			{
+				for (const glm::ivec3& offset : offsets)
+				{
+					if (const auto chunkLocation = chunks.find(chunkPosition + offset);
+						chunkLocation != chunks.end())
+					{
+						foundCount += static_cast<size_t>(chunkLocation->second);
+					}
+				}
+			}
+		}
+
+		Benchmark::Consume(foundCount);
+	});
+
+	const double lookupCount = static_cast<double>(s_PassCount) * static_cast<double>(chunkPositions.size()) * static_cast<double>(offsets.size());
+
+	return time * 1'000'000.0 / lookupCount;
+}
+
+BENCHMARK(ChunkMapLookup)
+{
+	for (const int chunkLoadRadius : { 8, 16, 32 })
+	{
+		const std::vector<glm::ivec3> chunkPositions = GetChunkPositions(chunkLoadRadius);
+
+		ChunkMap<int> chunkMap;
+		std::unordered_map<glm::ivec3, int, ReferenceChunkPositionHash> referenceMap;
+
+		for (const glm::ivec3& chunkPosition : chunkPositions)
+		{
+			chunkMap.insert(std::make_pair(chunkPosition, 1));
+			referenceMap.insert(std::make_pair(chunkPosition, 1));
+		}
+
+		size_t maxBucketSize = 0;
+
+		for (size_t i = 0; i < referenceMap.bucket_count(); ++i)
+		{
+			maxBucketSize = std::max(maxBucketSize, referenceMap.bucket_size(i));
+		}
+
+		const double referenceLookupTime = MeasureLookupNanoseconds(referenceMap, chunkPositions);
+		const double lookupTime = MeasureLookupNanoseconds(chunkMap, chunkPositions);
+
+		std::ostringstream resultStream;
+		resultStream << std::fixed << std::setprecision(1) << "radius " << chunkLoadRadius << ", " << chunkPositions.size() << " chunks: " << referenceLookupTime << "ns per unordered_map lookup (largest bucket " << maxBucketSize << "), " << lookupTime << "ns per ChunkMap lookup";
+
+		Benchmark::Report(resultStream.str());
+	}
+}
\ No newline at end of file
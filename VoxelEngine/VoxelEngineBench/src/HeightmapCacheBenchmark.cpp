@@ -0,0 +1,141 @@
+#include <glm/glm.hpp>
+#include <glm/gtc/noise.hpp>
+
+#include <cstddef>
+#include <iomanip>
+#include <sstream>
+#include <vector>
+
+#include "../../VoxelEngine/src/voxel_engine/world/Chunk.h"
+#include "../../VoxelEngine/src/voxel_engine/world/HeightmapCache.h"
+#include "Benchmark.h"
+
+static constexpr int s_ChunkLoadRadius = 8;
+static constexpr int s_ChunkLayerCount = 4;
+static constexpr unsigned int s_Seed = 12'345u;
+static constexpr size_t s_HeightmapCacheCapacity = 1'024u;
+static constexpr unsigned int s_RepetitionCount = 5u;
+
+// Chunks within the load radius, in the order that the world streams them in.
+static std::vector<glm::ivec3> GetChunkPositions()
+{
+	std::vector<glm::ivec3> chunkPositions;
+
+	for (int x = -s_ChunkLoadRadius; x <= s_ChunkLoadRadius; ++x)
+	{
+		for (int z = -s_ChunkLoadRadius; z <= s_ChunkLoadRadius; ++z)
+		{
+			if (x * x + z * z > s_ChunkLoadRadius * s_ChunkLoadRadius)
+			{
+				continue;
+			}
+
+			for (int y = 0; y < s_ChunkLayerCount; ++y)
+			{
+				chunkPositions.push_back(glm::ivec3{ x, y, z } * glm::ivec3(Chunk::GetSize()));
+			}
+		}
+	}
+
+	return chunkPositions;
+}
+
+// The height that Chunk::GenerateBlocks evaluated for every voxel before HeightmapCache.
+static unsigned int GetReferenceHeight(const glm::vec3& position, const size_t x, const size_t z)
+{
+	unsigned int terrainHeight = static_cast<unsigned int>(glm::ceil(glm::simplex(glm::vec2{ (x + position.x + s_Seed) / 128.0f, (z + position.z + s_Seed) / 64.0f }) * 4.0f));
+	terrainHeight += static_cast<unsigned int>(glm::ceil(glm::simplex(glm::vec2{ (x + position.x - s_Seed) / 64.0f, (z + position.z - s_Seed) / 128.0f }) * 8.0f + 32.0f));
+
+	return terrainHeight;
+}
+
+BENCHMARK(HeightmapGeneration)
+{
+	constexpr glm::tvec3<size_t> ChunkSize = Chunk::GetSize();
+
+	const std::vector<glm::ivec3> chunkPositions = GetChunkPositions();
+	const double chunkCount = static_cast<double>(chunkPositions.size());
+
+	const double referenceTime = Benchmark::MeasureBestMilliseconds(s_RepetitionCount, [&]()
+	{
+		size_t heightSum = 0;
+
+		for (const glm::ivec3& chunkPosition : chunkPositions)
+		{
+			for (size_t x = 0; x < ChunkSize.x; ++x)
+			{
+				for (size_t y = 0; y < ChunkSize.y; ++y)
+				{
+					for (size_t z = 0; z < ChunkSize.z; ++z)
+					{
+						heightSum += GetReferenceHeight(glm::vec3(chunkPosition), x, z);
+					}
+				}
+			}
+		}
+
+		Benchmark::Consume(heightSum);
+	});
+
+	size_t noiseEvaluationCount = 0;
+
+	const double cacheTime = Benchmark::MeasureBestMilliseconds(s_RepetitionCount, [&]()
+	{
+		HeightmapCache heightmapCache(s_Seed, s_HeightmapCacheCapacity);
+		size_t heightSum = 0;
+
+		for (const glm::ivec3& chunkPosition : chunkPositions)
+		{
+			heightSum += heightmapCache.GetHeightmap(chunkPosition)[0];
+		}
+
+		Benchmark::Consume(heightSum);
+		noiseEvaluationCount = heightmapCache.GetStatistics().noiseEvaluationCount;
+	});
+
+	const double terrainTime = Benchmark::MeasureBestMilliseconds(s_RepetitionCount, [&]()
+	{
+		HeightmapCache heightmapCache(s_Seed, s_HeightmapCacheCapacity);
+		std::vector<Chunk::StructureBlock> structureBlocks;
+
+		for (const glm::ivec3& chunkPosition : chunkPositions)
+		{
+			structureBlocks.clear();
+			Benchmark::Consume(Chunk::GenerateTerrain(chunkPosition, heightmapCache, s_Seed, structureBlocks).size());
+		}
+	});
+
+	HeightmapCache heightmapCache(s_Seed, s_HeightmapCacheCapacity);
+	size_t mismatchedHeightCount = 0;
+
+	for (const glm::ivec3& chunkPosition : chunkPositions)
+	{
+		const HeightmapCache::Heightmap heights = heightmapCache.GetHeightmap(chunkPosition);
+
+		for (size_t x = 0; x < ChunkSize.x; ++x)
+		{
+			for (size_t z = 0; z < ChunkSize.z; ++z)
+			{
+				if (heights[HeightmapCache::GetHeightIndex(x, z)] != GetReferenceHeight(glm::vec3(chunkPosition), x, z))
+				{
+					++mismatchedHeightCount;
+				}
+			}
+		}
+	}
+
+	const size_t referenceNoiseEvaluationCount = ChunkSize.x * ChunkSize.y * ChunkSize.z * 2u;
+
+	std::ostringstream referenceResultStream;
+	referenceResultStream << std::fixed << std::setprecision(3) << "per-voxel noise: " << referenceNoiseEvaluationCount << " evaluations and " << referenceTime / chunkCount << "ms per chunk over " << chunkPositions.size() << " chunks";
+
+	std::ostringstream cacheResultStream;
+	cacheResultStream << std::fixed << std::setprecision(4) << "heightmap cache: " << static_cast<double>(noiseEvaluationCount) / chunkCount << " evaluations and " << cacheTime / chunkCount << "ms per chunk, " << terrainTime / chunkCount << "ms per chunk including block generation";
+
+	std::ostringstream mismatchResultStream;
+	mismatchResultStream << mismatchedHeightCount << " cached height(s) that differ from the per-voxel formula";
+
+	Benchmark::Report(referenceResultStream.str());
+	Benchmark::Report(cacheResultStream.str());
+	Benchmark::Report(mismatchResultStream.str());
+}
\ No newline at end of file
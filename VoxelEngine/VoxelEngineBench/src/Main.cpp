@@ -0,0 +1,11 @@
+#include <string_view>
+#include <vector>
+
+#include "Benchmark.h"
+
+int main(int argc, char* argv[])
+{
+	const std::vector<std::string_view> filters(argv + 1, argv + argc);
+
+	return Benchmark::RunAll(filters);
+}
\ No newline at end of file
@@ -0,0 +1,76 @@
+#include <glm/glm.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <initializer_list>
+#include <iomanip>
+#include <limits>
+#include <memory>
+#include <sstream>
+#include <vector>
+
+#include "../../VoxelEngine/src/engine/camera/Camera3D.h"
+#include "../../VoxelEngine/src/voxel_engine/world/BlockRegistry.h"
+#include "../../VoxelEngine/src/voxel_engine/world/Chunk.h"
+#include "../../VoxelEngine/src/voxel_engine/world/World.h"
+#include "Benchmark.h"
+#include "BenchmarkContext.h"
+
+static constexpr int s_ChunkLoadRadius = 8;
+static constexpr unsigned int s_MeshRepetitionCount = 5u;
+static constexpr unsigned int s_DrawWarmupFrameCount = 10u;
+static constexpr unsigned int s_DrawFrameCount = 100u;
+
+BENCHMARK(GreedyMeshing)
+{
+	const BenchmarkContext& context = BenchmarkContext::Get();
+	const BlockRegistry blockRegistry(context.GetBlockTileMap());
+
+	// Looks straight down on the whole load radius so that every chunk is drawn.
+	const Camera3D camera{ glm::vec3{ 0.0f, 200.0f, 0.0f }, glm::vec3{ 0.0f, 1.0f, 0.0f }, -90.0f, -89.0f };
+
+	for (const Chunk::MeshingMode meshingMode : { Chunk::MeshingMode::PerFace, Chunk::MeshingMode::Greedy })
+	{
+		Config config = BenchmarkContext::CreateConfig(static_cast<unsigned int>(s_ChunkLoadRadius));
+		config.enableGreedyMeshing = meshingMode == Chunk::MeshingMode::Greedy;
+
+		const std::unique_ptr<World> world = context.CreateWorld(config, camera);
+		const std::vector<Chunk::MeshSnapshot> snapshots = BenchmarkContext::CreateMeshSnapshots(*world, s_ChunkLoadRadius);
+
+		size_t vertexCount = 0;
+
+		const double meshTime = Benchmark::MeasureBestMilliseconds(s_MeshRepetitionCount, [&]()
+		{
+			vertexCount = 0;
+
+			for (const auto& snapshot : snapshots)
+			{
+				vertexCount += Chunk::GenerateMesh(snapshot, blockRegistry, meshingMode).vertices.size();
+			}
+		});
+
+		for (unsigned int i = 0; i < s_DrawWarmupFrameCount; ++i)
+		{
+			context.RenderWorld(*world, camera);
+		}
+
+		double drawTime = std::numeric_limits<double>::infinity();
+		double totalDrawTime = 0.0;
+
+		for (unsigned int i = 0; i < s_DrawFrameCount; ++i)
+		{
+			const double frameDrawTime = context.MeasureGPUMilliseconds([&]()
+			{
+				context.RenderWorld(*world, camera);
+			});
+
+			drawTime = std::min(drawTime, frameDrawTime);
+			totalDrawTime += frameDrawTime;
+		}
+
+		std::ostringstream resultStream;
+		resultStream << std::fixed << std::setprecision(3) << (meshingMode == Chunk::MeshingMode::Greedy ? "greedy:   " : "per-face: ") << vertexCount << " vertices in " << snapshots.size() << " chunks, " << meshTime << "ms to mesh, " << drawTime << "ms minimum and " << totalDrawTime / s_DrawFrameCount << "ms mean GPU time to draw " << world->GetRenderStatistics().visibleChunkCount << " visible chunks";
+
+		Benchmark::Report(resultStream.str());
+	}
+}
\ No newline at end of file
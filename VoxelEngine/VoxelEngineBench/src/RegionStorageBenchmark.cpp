@@ -0,0 +1,124 @@
+#include <glm/glm.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <iomanip>
+#include <optional>
+#include <sstream>
+#include <string>
+#include <system_error>
+#include <vector>
+
+#include "../../VoxelEngine/src/voxel_engine/world/Block.h"
+#include "../../VoxelEngine/src/voxel_engine/world/Chunk.h"
+#include "../../VoxelEngine/src/voxel_engine/world/HeightmapCache.h"
+#include "../../VoxelEngine/src/voxel_engine/world/RegionFile.h"
+#include "../../VoxelEngine/src/voxel_engine/world/RegionStorage.h"
+#include "Benchmark.h"
+#include "BenchmarkContext.h"
+
+static constexpr int s_ChunkRadius = 4;
+static constexpr unsigned int s_ChunkHeight = 4u;
+static constexpr size_t s_HeightmapCacheCapacity = 1'024u;
+static constexpr unsigned int s_RepetitionCount = 5u;
+
+static std::vector<glm::ivec3> GetChunkIndices()
+{
+	std::vector<glm::ivec3> chunkIndices;
+
+	for (int x = -s_ChunkRadius; x <= s_ChunkRadius; ++x)
+	{
+		for (int z = -s_ChunkRadius; z <= s_ChunkRadius; ++z)
+		{
+			for (int y = 0; y < static_cast<int>(s_ChunkHeight); ++y)
+			{
+				chunkIndices.emplace_back(x, y, z);
+			}
+		}
+	}
+
+	return chunkIndices;
+}
+
+static size_t GetDirectorySize(const std::string& directory)
+{
+	std::error_code errorCode;
+	size_t directorySize = 0;
+
+	for (const auto& entry : std::filesystem::recursive_directory_iterator(directory, errorCode))
+	{
+		if (entry.is_regular_file(errorCode))
+		{
+			directorySize += static_cast<size_t>(entry.file_size(errorCode));
+		}
+	}
+
+	return directorySize;
+}
+
+BENCHMARK(RegionLoading)
+{
+	constexpr size_t ChunkBlockCount = Chunk::GetSize().x * Chunk::GetSize().y * Chunk::GetSize().z;
+
+	const std::string saveDirectory = BenchmarkContext::GetSaveDirectory("regions");
+	const std::vector<glm::ivec3> chunkIndices = GetChunkIndices();
+
+	unsigned int seed = 0;
+	std::vector<std::vector<Block>> generatedBlocks(chunkIndices.size());
+
+	{
+		RegionStorage regionStorage(saveDirectory, s_ChunkHeight, ChunkBlockCount);
+		seed = regionStorage.GetSeed();
+	}
+
+	const double generateTime = Benchmark::MeasureBestMilliseconds(s_RepetitionCount, [&]()
+	{
+		HeightmapCache heightmapCache(seed, s_HeightmapCacheCapacity);
+		std::vector<Chunk::StructureBlock> structureBlocks;
+
+		for (size_t i = 0; i < chunkIndices.size(); ++i)
+		{
+			structureBlocks.clear();
+			generatedBlocks[i] = Chunk::GenerateTerrain(chunkIndices[i] * glm::ivec3(Chunk::GetSize()), heightmapCache, seed, structureBlocks);
+		}
+	});
+
+	{
+		RegionStorage regionStorage(saveDirectory, s_ChunkHeight, ChunkBlockCount);
+
+		for (size_t i = 0; i < chunkIndices.size(); ++i)
+		{
+			regionStorage.SaveChunk(chunkIndices[i], RegionFile::ChunkData{ generatedBlocks[i], RegionFile::s_AllStructureSources });
+		}
+	}
+
+	std::vector<std::optional<RegionFile::ChunkData>> loadedChunks(chunkIndices.size());
+
+	const double loadTime = Benchmark::MeasureBestMilliseconds(s_RepetitionCount, [&]()
+	{
+		RegionStorage regionStorage(saveDirectory, s_ChunkHeight, ChunkBlockCount);
+
+		for (size_t i = 0; i < chunkIndices.size(); ++i)
+		{
+			loadedChunks[i] = regionStorage.LoadChunk(chunkIndices[i]);
+		}
+	});
+
+	size_t mismatchedChunkCount = 0;
+
+	for (size_t i = 0; i < chunkIndices.size(); ++i)
+	{
+		if (!loadedChunks[i].has_value() || loadedChunks[i]->blocks != generatedBlocks[i])
+		{
+			++mismatchedChunkCount;
+		}
+	}
+
+	const size_t saveSize = GetDirectorySize(saveDirectory);
+
+	std::ostringstream resultStream;
+	resultStream << std::fixed << std::setprecision(2) << chunkIndices.size() << " chunks: " << generateTime << "ms to generate, " << loadTime << "ms to load from region files (" << generateTime / loadTime << "x), " << saveSize / chunkIndices.size() << " bytes per chunk on disk, " << mismatchedChunkCount << " chunk(s) loaded differently from how they were generated";
+
+	Benchmark::Report(resultStream.str());
+}
\ No newline at end of file
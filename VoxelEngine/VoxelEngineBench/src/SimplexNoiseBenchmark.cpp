@@ -0,0 +1,100 @@
+#include <glm/glm.hpp>
+
+#include <cstddef>
+#include <cstring>
+#include <initializer_list>
+#include <iomanip>
+#include <random>
+#include <sstream>
+#include <vector>
+
+#include "../../VoxelEngine/src/engine/utility/SimplexNoise.h"
+#include "Benchmark.h"
+
+static constexpr size_t s_SampleCount = 2'000'000u;
+static constexpr unsigned int s_RepetitionCount = 5u;
+static constexpr unsigned int s_RandomSeed = 5'489u;
+
+// Half of the positions stay near the origin and half span the range that terrain uses far from spawn.
+static std::vector<glm::vec2> CreatePositions()
+{
+	std::mt19937 randomEngine(s_RandomSeed);
+	std::uniform_real_distribution<float> smallDistribution(-64.0f, 64.0f);
+	std::uniform_real_distribution<float> largeDistribution(-100'000.0f, 100'000.0f);
+
+	std::vector<glm::vec2> positions(s_SampleCount);
+
+	for (size_t i = 0; i < positions.size(); ++i)
+	{
+		std::uniform_real_distribution<float>& distribution = i % 2 == 0 ? smallDistribution : largeDistribution;
+		positions[i] = glm::vec2{ distribution(randomEngine), distribution(randomEngine) };
+	}
+
+	return positions;
+}
+
+static const char* GetInstructionSetName(const SimplexNoise::InstructionSet instructionSet) noexcept
+{
+	switch (instructionSet)
+	{
+	case SimplexNoise::InstructionSet::SSE2:
+		return "SSE2:   ";
+
+	case SimplexNoise::InstructionSet::AVX:
+		return "AVX:    ";
+
+	case SimplexNoise::InstructionSet::Scalar:
+	default:
+		return "scalar: ";
+	}
+}
+
+BENCHMARK(SimplexNoiseBatch)
+{
+	const std::vector<glm::vec2> positions = CreatePositions();
+
+	std::vector<float> scalarValues;
+	SimplexNoise::Generate2D(positions, scalarValues, SimplexNoise::InstructionSet::Scalar);
+
+	double scalarTime = 0.0;
+
+	for (const SimplexNoise::InstructionSet instructionSet : { SimplexNoise::InstructionSet::Scalar, SimplexNoise::InstructionSet::SSE2, SimplexNoise::InstructionSet::AVX })
+	{
+		std::ostringstream resultStream;
+		resultStream << GetInstructionSetName(instructionSet);
+
+		if (instructionSet > SimplexNoise::GetSupportedInstructionSet())
+		{
+			resultStream << "not supported by this CPU";
+			Benchmark::Report(resultStream.str());
+
+			continue;
+		}
+
+		std::vector<float> values;
+
+		const double time = Benchmark::MeasureBestMilliseconds(s_RepetitionCount, [&]()
+		{
+			SimplexNoise::Generate2D(positions, values, instructionSet);
+		});
+
+		if (instructionSet == SimplexNoise::InstructionSet::Scalar)
+		{
+			scalarTime = time;
+		}
+
+		size_t mismatchedValueCount = 0;
+
+		for (size_t i = 0; i < values.size(); ++i)
+		{
+			if (std::memcmp(&values[i], &scalarValues[i], sizeof(float)) != 0)
+			{
+				++mismatchedValueCount;
+			}
+		}
+
+		resultStream << std::fixed << std::setprecision(1) << static_cast<double>(positions.size()) / time / 1'000.0 << " million samples per second, " << scalarTime / time << "x scalar, " << mismatchedValueCount << " value(s) that differ bitwise from glm::simplex";
+
+		Benchmark::Report(resultStream.str());
+	}
+}
\ No newline at end of file
@@ -0,0 +1,126 @@
+#include <glm/glm.hpp>
+#include <glm/gtc/constants.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <initializer_list>
+#include <iomanip>
+#include <memory>
+#include <random>
+#include <sstream>
+#include <vector>
+
+#include "../../VoxelEngine/src/engine/graphics/SpriteBatch.h"
+#include "../../VoxelEngine/src/engine/graphics/Texture.h"
+#include "Benchmark.h"
+#include "BenchmarkContext.h"
+
+static constexpr size_t s_TextureCount = 8u;
+static constexpr size_t s_SpritesPerFrame = 10'000u;
+static constexpr unsigned int s_WarmupFrameCount = 10u;
+static constexpr unsigned int s_FrameCount = 100u;
+static constexpr unsigned int s_RandomSeed = 5'489u;
+
+struct SpriteDescription
+{
+	size_t textureIndex = 0;
+	glm::vec2 position{ 0.0f, 0.0f };
+	glm::vec2 size{ 0.0f, 0.0f };
+	float rotation = 0.0f;
+	glm::vec4 colour{ 1.0f };
+};
+
+static std::vector<SpriteDescription> CreateSprites(const glm::vec2& windowSize)
+{
+	std::mt19937 randomEngine(s_RandomSeed);
+	std::uniform_int_distribution<size_t> textureDistribution(0u, s_TextureCount - 1u);
+	std::uniform_real_distribution<float> xDistribution(0.0f, windowSize.x);
+	std::uniform_real_distribution<float> yDistribution(0.0f, windowSize.y);
+	std::uniform_real_distribution<float> sizeDistribution(8.0f, 32.0f);
+	std::uniform_real_distribution<float> rotationDistribution(0.0f, glm::two_pi<float>());
+	std::uniform_real_distribution<float> colourDistribution(0.0f, 1.0f);
+
+	std::vector<SpriteDescription> sprites(s_SpritesPerFrame);
+
+	for (auto& sprite : sprites)
+	{
+		sprite.textureIndex = textureDistribution(randomEngine);
+		sprite.position = glm::vec2{ xDistribution(randomEngine), yDistribution(randomEngine) };
+		sprite.size = glm::vec2{ sizeDistribution(randomEngine) };
+		sprite.rotation = rotationDistribution(randomEngine);
+		sprite.colour = glm::vec4{ colourDistribution(randomEngine), colourDistribution(randomEngine), colourDistribution(randomEngine), 1.0f };
+	}
+
+	return sprites;
+}
+
+BENCHMARK(SpriteBatching)
+{
+	const BenchmarkContext& context = BenchmarkContext::Get();
+
+	// Every texture is its own GL object, so the batch sees eight distinct textures to sort sprites by.
+	std::vector<Texture> textures;
+	textures.reserve(s_TextureCount);
+
+	for (size_t i = 0; i < s_TextureCount; ++i)
+	{
+		textures.emplace_back(BenchmarkContext::GetGamePath("assets/textures/crosshair.png"));
+	}
+
+	const std::vector<SpriteDescription> sprites = CreateSprites(glm::vec2(context.GetWindow().GetSize()));
+
+	// The game's region size, which a 10k sprite frame overflows several times, and one that holds the whole frame.
+	for (const size_t spritesPerRegion : { size_t{ 1'024u }, s_SpritesPerFrame })
+	{
+		const std::unique_ptr<SpriteBatch> spriteBatch = context.CreateSpriteBatch(spritesPerRegion);
+
+		const auto drawFrame = [&]()
+		{
+			spriteBatch->Begin();
+
+			for (const auto& sprite : sprites)
+			{
+				spriteBatch->Draw(textures[sprite.textureIndex], sprite.position, sprite.size, sprite.rotation, sprite.colour);
+			}
+
+			spriteBatch->End();
+		};
+
+		for (unsigned int i = 0; i < s_WarmupFrameCount; ++i)
+		{
+			context.BeginOverlayFrame();
+			drawFrame();
+			context.EndFrame();
+		}
+
+		double totalCPUTime = 0.0;
+		double maxCPUTime = 0.0;
+		double totalGPUTime = 0.0;
+		size_t regionWaitCount = 0;
+
+		for (unsigned int i = 0; i < s_FrameCount; ++i)
+		{
+			context.BeginOverlayFrame();
+
+			double cpuTime = 0.0;
+
+			totalGPUTime += context.MeasureGPUMilliseconds([&]()
+			{
+				cpuTime = Benchmark::MeasureMilliseconds(drawFrame);
+			});
+
+			context.EndFrame();
+
+			totalCPUTime += cpuTime;
+			maxCPUTime = std::max(maxCPUTime, cpuTime);
+			regionWaitCount += spriteBatch->GetStatistics().regionWaitCount;
+		}
+
+		const SpriteBatch::Statistics& statistics = spriteBatch->GetStatistics();
+
+		std::ostringstream resultStream;
+		resultStream << std::fixed << std::setprecision(3) << spritesPerRegion << " sprites per region: " << statistics.spriteCount << " sprites in " << statistics.drawCallCount << " draw calls, " << totalCPUTime / s_FrameCount << "ms mean and " << maxCPUTime << "ms worst CPU time, " << totalGPUTime / s_FrameCount << "ms mean GPU time, " << regionWaitCount << " region wait(s) over " << s_FrameCount << " frames";
+
+		Benchmark::Report(resultStream.str());
+	}
+}
\ No newline at end of file
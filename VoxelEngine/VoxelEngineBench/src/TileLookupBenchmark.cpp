@@ -0,0 +1,207 @@
+#include <glm/glm.hpp>
+
+#include <array>
+#include <cstddef>
+#include <iomanip>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "../../VoxelEngine/src/engine/camera/Camera3D.h"
+#include "../../VoxelEngine/src/engine/graphics/TileMap.h"
+#include "../../VoxelEngine/src/voxel_engine/world/Block.h"
+#include "../../VoxelEngine/src/voxel_engine/world/BlockRegistry.h"
+#include "../../VoxelEngine/src/voxel_engine/world/Chunk.h"
+#include "../../VoxelEngine/src/voxel_engine/world/World.h"
+#include "Benchmark.h"
+#include "BenchmarkContext.h"
+
+static constexpr int s_ChunkLoadRadius = 8;
+static constexpr size_t s_FaceHeavyChunkCount = 144u;
+static constexpr unsigned int s_RepetitionCount = 15u;
+
+static constexpr std::array<Direction, 6u> s_Directions{ Direction::North, Direction::East, Direction::South, Direction::West, Direction::Zenith, Direction::Nadir };
+static constexpr std::array<Block, 10u> s_SolidBlocks{ Block::Stone, Block::Dirt, Block::Grass, Block::Bedrock, Block::Log, Block::Leaves, Block::Planks, Block::Cobblestone, Block::Glass, Block::Pumpkin };
+
+// The per-face texture name that meshing built before BlockRegistry, kept as the baseline for its table.
+static std::string GetReferenceTextureName(const Block block, const Direction direction)
+{
+	switch (block)
+	{
+	case Block::Stone:
+		return "stone";
+
+	case Block::Dirt:
+		return "dirt";
+
+	case Block::Grass:
+		switch (direction)
+		{
+		case Direction::Zenith:
+			return "grass_top";
+
+		case Direction::Nadir:
+			return "dirt";
+
+		default:
+			return "grass_side";
+		}
+
+	case Block::Bedrock:
+		return "bedrock";
+
+	case Block::Log:
+		switch (direction)
+		{
+		case Direction::Zenith:
+		case Direction::Nadir:
+			return "log_top";
+
+		default:
+			return "log_side";
+		}
+
+	case Block::Leaves:
+		return "leaves";
+
+	case Block::Planks:
+		return "planks";
+
+	case Block::Cobblestone:
+		return "cobblestone";
+
+	case Block::Glass:
+		return "glass";
+
+	case Block::Pumpkin:
+		switch (direction)
+		{
+		case Direction::Zenith:
+			return "pumpkin_top";
+
+		case Direction::Nadir:
+			return "pumpkin_bottom";
+
+		default:
+			return "pumpkin_side";
+		}
+
+	default:
+		return "";
+	}
+}
+
+// Fills every other block of each chunk in a checkerboard so that almost every block shows all six faces.
+static std::vector<Chunk::MeshSnapshot> CreateFaceHeavySnapshots()
+{
+	constexpr glm::tvec3<size_t> ChunkSize = Chunk::GetSize();
+
+	std::vector<Chunk::MeshSnapshot> snapshots(s_FaceHeavyChunkCount);
+
+	for (size_t i = 0; i < snapshots.size(); ++i)
+	{
+		snapshots[i].blocks.resize(ChunkSize.x * ChunkSize.y * ChunkSize.z, Block::Air);
+
+		for (size_t blockIndex = 0; blockIndex < snapshots[i].blocks.size(); ++blockIndex)
+		{
+			const size_t x = blockIndex / (ChunkSize.y * ChunkSize.z);
+			const size_t y = blockIndex / ChunkSize.z % ChunkSize.y;
+			const size_t z = blockIndex % ChunkSize.z;
+
+			if ((x + y + z) % 2 == 0)
+			{
+				snapshots[i].blocks[blockIndex] = s_SolidBlocks[(blockIndex + i) % s_SolidBlocks.size()];
+			}
+		}
+	}
+
+	return snapshots;
+}
+
+struct VisibleFace
+{
+	Block block = Block::Air;
+	Direction direction = Direction::North;
+};
+
+// Only the faces that meshing emits are looked up, so the timings exclude the scan over empty face masks.
+static std::vector<VisibleFace> GetVisibleFaces(const std::vector<Chunk::MeshSnapshot>& snapshots)
+{
+	std::vector<VisibleFace> visibleFaces;
+
+	for (const auto& snapshot : snapshots)
+	{
+		size_t faceCount = 0;
+		const std::vector<unsigned char> blockFaces = Chunk::GetBlockFaces(snapshot, faceCount);
+
+		for (size_t blockIndex = 0; blockIndex < blockFaces.size(); ++blockIndex)
+		{
+			for (const Direction direction : s_Directions)
+			{
+				if (blockFaces[blockIndex] & direction)
+				{
+					visibleFaces.push_back(VisibleFace{ snapshot.blocks[blockIndex], direction });
+				}
+			}
+		}
+	}
+
+	return visibleFaces;
+}
+
+template <typename F>
+static double MeasureTileLookups(const std::vector<VisibleFace>& visibleFaces, const F& getTileIndex)
+{
+	return Benchmark::MeasureBestMilliseconds(s_RepetitionCount, [&]()
+	{
+		size_t tileIndexSum = 0;
+
+		for (const auto& visibleFace : visibleFaces)
+		{
+			tileIndexSum += getTileIndex(visibleFace.block, visibleFace.direction);
+		}
+
+		Benchmark::Consume(tileIndexSum);
+	});
+}
+
+static void ReportTileLookups(const char* const name, const std::vector<Chunk::MeshSnapshot>& snapshots, const TileMap& tileMap, const BlockRegistry& blockRegistry)
+{
+	const std::vector<VisibleFace> visibleFaces = GetVisibleFaces(snapshots);
+
+	const double stringLookupTime = MeasureTileLookups(visibleFaces, [&tileMap](const Block block, const Direction direction)
+	{
+		return tileMap.GetTileIndex(GetReferenceTextureName(block, direction));
+	});
+
+	const double tableLookupTime = MeasureTileLookups(visibleFaces, [&blockRegistry](const Block block, const Direction direction)
+	{
+		return blockRegistry.GetTileIndex(block, direction);
+	});
+
+	const double meshTime = Benchmark::MeasureBestMilliseconds(s_RepetitionCount, [&]()
+	{
+		for (const auto& snapshot : snapshots)
+		{
+			Benchmark::Consume(Chunk::GenerateMesh(snapshot, blockRegistry, Chunk::MeshingMode::PerFace).vertices.size());
+		}
+	});
+
+	std::ostringstream resultStream;
+	resultStream << std::fixed << std::setprecision(2) << name << visibleFaces.size() << " faces in " << snapshots.size() << " chunks, " << stringLookupTime << "ms with texture names, " << tableLookupTime << "ms with the block registry, " << meshTime << "ms for a whole per-face meshing pass";
+
+	Benchmark::Report(resultStream.str());
+}
+
+BENCHMARK(TileLookup)
+{
+	const BenchmarkContext& context = BenchmarkContext::Get();
+	const BlockRegistry blockRegistry(context.GetBlockTileMap());
+	const Camera3D camera{ glm::vec3{ 0.0f, 48.0f, 0.0f } };
+
+	const std::unique_ptr<World> world = context.CreateWorld(BenchmarkContext::CreateConfig(static_cast<unsigned int>(s_ChunkLoadRadius)), camera);
+
+	ReportTileLookups("terrain:    ", BenchmarkContext::CreateMeshSnapshots(*world, s_ChunkLoadRadius), context.GetBlockTileMap(), blockRegistry);
+	ReportTileLookups("face-heavy: ", CreateFaceHeavySnapshots(), context.GetBlockTileMap(), blockRegistry);
+}
\ No newline at end of file
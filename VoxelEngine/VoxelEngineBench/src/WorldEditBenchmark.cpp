@@ -0,0 +1,125 @@
+#include <glm/glm.hpp>
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <iomanip>
+#include <memory>
+#include <random>
+#include <sstream>
+
+#include "../../VoxelEngine/src/engine/camera/Camera3D.h"
+#include "../../VoxelEngine/src/voxel_engine/world/Block.h"
+#include "../../VoxelEngine/src/voxel_engine/world/Chunk.h"
+#include "../../VoxelEngine/src/voxel_engine/world/World.h"
+#include "Benchmark.h"
+#include "BenchmarkContext.h"
+
+static constexpr unsigned int s_ChunkLoadRadius = 4u;
+static constexpr unsigned int s_WorkerThreadCount = 4u;
+static constexpr int s_EditHeight = 64;
+static constexpr unsigned int s_FrameCount = 10u;
+static constexpr size_t s_EditsPerFrame = 100'000u;
+static constexpr unsigned int s_RandomSeed = 5'489u;
+
+static constexpr std::array<Block, 4u> s_EditBlocks{ Block::Air, Block::Stone, Block::Planks, Block::Glass };
+
+struct FrameTimes
+{
+	double editTime = 0.0;
+	double updateTime = 0.0;
+	double meshTime = 0.0;
+};
+
+// Update only queues the remeshes on the worker threads, so each frame also waits for them and uploads every mesh before it is counted as done.
+template <typename F>
+static FrameTimes MeasureFrame(World& world, const F& editBlocks)
+{
+	FrameTimes frameTimes;
+	frameTimes.editTime = Benchmark::MeasureMilliseconds(editBlocks);
+
+	frameTimes.updateTime = Benchmark::MeasureMilliseconds([&world]()
+	{
+		world.Update();
+	});
+
+	frameTimes.meshTime = Benchmark::MeasureMilliseconds([&world]()
+	{
+		world.FlushChunkMeshes();
+	});
+
+	return frameTimes;
+}
+
+static void ReportFrame(const char* const name, const World& world, const FrameTimes& frameTimes)
+{
+	const World::EditStatistics& editStatistics = world.GetEditStatistics();
+
+	std::ostringstream resultStream;
+	resultStream << std::fixed << std::setprecision(2) << name << editStatistics.editedBlockCount << " blocks changed, " << editStatistics.remeshedChunkCount << " chunks remeshed, " << frameTimes.editTime << "ms to edit, " << frameTimes.updateTime << "ms to update the world, " << frameTimes.meshTime << "ms until every remeshed chunk is uploaded";
+
+	Benchmark::Report(resultStream.str());
+}
+
+BENCHMARK(WorldEdits)
+{
+	const BenchmarkContext& context = BenchmarkContext::Get();
+	const Camera3D camera{ glm::vec3{ 8.0f, 48.0f, 8.0f } };
+
+	// Edited chunks are saved when the world is destroyed, so they must not land where other benchmarks load from.
+	Config config = BenchmarkContext::CreateConfig(s_ChunkLoadRadius, s_WorkerThreadCount);
+	config.saveDirectory = BenchmarkContext::GetSaveDirectory("edits");
+
+	const std::unique_ptr<World> world = context.CreateWorld(config, camera);
+
+	const int horizontalExtent = static_cast<int>(s_ChunkLoadRadius * Chunk::GetSize().x);
+	std::mt19937 randomEngine(s_RandomSeed);
+	std::uniform_int_distribution<int> horizontalDistribution(-horizontalExtent, horizontalExtent + static_cast<int>(Chunk::GetSize().x) - 1);
+	std::uniform_int_distribution<int> verticalDistribution(0, s_EditHeight - 1);
+	std::uniform_int_distribution<size_t> blockDistribution(0u, s_EditBlocks.size() - 1u);
+
+	// Any meshes still in flight from loading the world would otherwise be counted against the first frame.
+	world->FlushChunkMeshes();
+
+	double totalFrameTime = 0.0;
+	double maxFrameTime = 0.0;
+	double totalUpdateTime = 0.0;
+	double totalMeshTime = 0.0;
+	size_t maxRemeshedChunkCount = 0;
+
+	for (unsigned int frame = 0; frame < s_FrameCount; ++frame)
+	{
+		const FrameTimes frameTimes = MeasureFrame(*world, [&]()
+		{
+			for (size_t i = 0; i < s_EditsPerFrame; ++i)
+			{
+				world->SetBlock(glm::ivec3{ horizontalDistribution(randomEngine), verticalDistribution(randomEngine), horizontalDistribution(randomEngine) }, s_EditBlocks[blockDistribution(randomEngine)]);
+			}
+		});
+
+		std::ostringstream frameNameStream;
+		frameNameStream << "random frame " << frame << ": ";
+		ReportFrame(frameNameStream.str().c_str(), *world, frameTimes);
+
+		const double frameTime = frameTimes.editTime + frameTimes.updateTime + frameTimes.meshTime;
+
+		totalFrameTime += frameTime;
+		maxFrameTime = std::max(maxFrameTime, frameTime);
+		totalUpdateTime += frameTimes.updateTime;
+		totalMeshTime += frameTimes.meshTime;
+		maxRemeshedChunkCount = std::max(maxRemeshedChunkCount, world->GetEditStatistics().remeshedChunkCount);
+	}
+
+	std::ostringstream summaryStream;
+	summaryStream << std::fixed << std::setprecision(2) << s_EditsPerFrame << " random edits per frame: " << totalFrameTime / s_FrameCount << "ms mean and " << maxFrameTime << "ms worst frame including meshing, " << totalUpdateTime / s_FrameCount << "ms mean update, " << totalMeshTime / s_FrameCount << "ms mean meshing and upload, at most " << maxRemeshedChunkCount << " chunks remeshed per frame";
+
+	Benchmark::Report(summaryStream.str());
+
+	const FrameTimes fillFrameTimes = MeasureFrame(*world, [&]()
+	{
+		world->FillBlocks(glm::ivec3{ -40, 8, -40 }, glm::ivec3{ 39, 47, 39 }, Block::Cobblestone);
+		world->ReplaceBlocks(glm::ivec3{ -64, 0, -64 }, glm::ivec3{ 63, 63, 63 }, Block::Cobblestone, Block::Planks);
+	});
+
+	ReportFrame("80x40x80 fill and 128x64x128 replace: ", *world, fillFrameTimes);
+}
\ No newline at end of file
@@ -0,0 +1,51 @@
+#include <glm/glm.hpp>
+
+#include <algorithm>
+#include <initializer_list>
+#include <iomanip>
+#include <limits>
+#include <memory>
+#include <sstream>
+
+#include "../../VoxelEngine/src/engine/camera/Camera3D.h"
+#include "../../VoxelEngine/src/engine/utility/ThreadPool.h"
+#include "../../VoxelEngine/src/voxel_engine/world/World.h"
+#include "Benchmark.h"
+#include "BenchmarkContext.h"
+
+static constexpr unsigned int s_ChunkLoadRadius = 8u;
+static constexpr unsigned int s_RepetitionCount = 3u;
+
+BENCHMARK(WorldStartup)
+{
+	const BenchmarkContext& context = BenchmarkContext::Get();
+	const Camera3D camera{ glm::vec3{ 0.0f, 48.0f, 0.0f } };
+
+	double singleWorkerTime = 0.0;
+
+	for (const unsigned int workerCount : { 1u, 2u, 4u, ThreadPool::GetDefaultWorkerCount() })
+	{
+		const Config config = BenchmarkContext::CreateConfig(s_ChunkLoadRadius, workerCount);
+		double startupTime = std::numeric_limits<double>::infinity();
+
+		for (unsigned int i = 0; i < s_RepetitionCount; ++i)
+		{
+			std::unique_ptr<World> world = nullptr;
+
+			startupTime = std::min(startupTime, Benchmark::MeasureMilliseconds([&]()
+			{
+				world = context.CreateWorld(config, camera);
+			}));
+		}
+
+		if (workerCount == 1u)
+		{
+			singleWorkerTime = startupTime;
+		}
+
+		std::ostringstream resultStream;
+		resultStream << std::fixed << std::setprecision(2) << workerCount << " worker(s): " << startupTime << "ms to generate and mesh a radius " << s_ChunkLoadRadius << " world, " << singleWorkerTime / startupTime << "x the single worker speed";
+
+		Benchmark::Report(resultStream.str());
+	}
+}
\ No newline at end of file
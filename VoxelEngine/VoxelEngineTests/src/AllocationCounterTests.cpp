@@ -0,0 +1,45 @@
+#include <cstddef>
+#include <new>
+#include <thread>
+
+#include "../../VoxelEngine/src/engine/utility/AllocationCounter.h"
+#include "Test.h"
+
+static constexpr size_t s_WorkerAllocationCount = 1'000u;
+
+TEST_CASE(AllocationCounterCountsThisThread)
+{
+	const size_t startAllocationCount = AllocationCounter::GetThreadAllocationCount();
+
+	// Calling the allocation functions directly keeps the compiler from eliding the pair as it may for a new-expression.
+	void* const memory = ::operator new(64u);
+	void* const arrayMemory = ::operator new[](64u);
+	::operator delete[](arrayMemory);
+	::operator delete(memory);
+
+	CHECK(AllocationCounter::GetThreadAllocationCount() - startAllocationCount == 2u);
+}
+
+TEST_CASE(AllocationCounterIgnoresOtherThreads)
+{
+	const size_t startAllocationCount = AllocationCounter::GetThreadAllocationCount();
+	size_t workerAllocationCount = 0;
+
+	std::thread worker([&workerAllocationCount]()
+	{
+		const size_t workerStartAllocationCount = AllocationCounter::GetThreadAllocationCount();
+
+		for (size_t i = 0; i < s_WorkerAllocationCount; ++i)
+		{
+			::operator delete(::operator new(16u));
+		}
+
+		workerAllocationCount = AllocationCounter::GetThreadAllocationCount() - workerStartAllocationCount;
+	});
+
+	worker.join();
+
+	// Starting the thread may allocate its shared state here, but none of the worker's own allocations land on this thread.
+	CHECK(workerAllocationCount == s_WorkerAllocationCount);
+	CHECK(AllocationCounter::GetThreadAllocationCount() - startAllocationCount < s_WorkerAllocationCount);
+}
\ No newline at end of file
@@ -0,0 +1,150 @@
+#include <glm/glm.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <initializer_list>
+#include <utility>
+#include <vector>
+
+#include "../../VoxelEngine/src/engine/utility/ThreadPool.h"
+#include "../../VoxelEngine/src/voxel_engine/world/Chunk.h"
+#include "../../VoxelEngine/src/voxel_engine/world/HeightmapCache.h"
+#include "Test.h"
+
+static constexpr unsigned int s_Seed = 1'234'567u;
+static constexpr int s_RegionRadius = 8;
+static constexpr int s_ChunkLayerCount = 4;
+
+// Smaller than the region's column count so that workers evict and regenerate heightmaps while others read them.
+static constexpr size_t s_HeightmapCacheCapacity = 64u;
+
+struct RegionHashes
+{
+	std::vector<std::uint64_t> chunkHashes;
+	size_t structureBlockCount = 0;
+};
+
+static std::vector<glm::ivec3> GetRegionChunkPositions()
+{
+	std::vector<glm::ivec3> chunkPositions;
+
+	for (int x = -s_RegionRadius; x <= s_RegionRadius; ++x)
+	{
+		for (int z = -s_RegionRadius; z <= s_RegionRadius; ++z)
+		{
+			for (int y = 0; y < s_ChunkLayerCount; ++y)
+			{
+				chunkPositions.push_back(glm::ivec3{ x, y, z } * glm::ivec3(Chunk::GetSize()));
+			}
+		}
+	}
+
+	return chunkPositions;
+}
+
+static std::uint64_t HashChunk(const std::vector<Block>& blocks, const std::vector<Chunk::StructureBlock>& structureBlocks)
+{
+	constexpr std::uint64_t OffsetBasis = 14'695'981'039'346'656'037ull;
+	constexpr std::uint64_t Prime = 1'099'511'628'211ull;
+
+	std::uint64_t hash = OffsetBasis;
+
+	const auto addValue = [&hash](const std::uint64_t value)
+	{
+		hash = (hash ^ value) * Prime;
+	};
+
+	for (const Block block : blocks)
+	{
+		addValue(static_cast<std::uint64_t>(block));
+	}
+
+	for (const auto& [position, block] : structureBlocks)
+	{
+		addValue(static_cast<std::uint32_t>(position.x));
+		addValue(static_cast<std::uint32_t>(position.y));
+		addValue(static_cast<std::uint32_t>(position.z));
+		addValue(static_cast<std::uint64_t>(block));
+	}
+
+	return hash;
+}
+
+static std::uint64_t GenerateChunkHash(const glm::ivec3& chunkPosition, HeightmapCache& heightmapCache, size_t& structureBlockCount)
+{
+	std::vector<Chunk::StructureBlock> structureBlocks;
+	const std::vector<Block> blocks = Chunk::GenerateTerrain(chunkPosition, heightmapCache, s_Seed, structureBlocks);
+	structureBlockCount = structureBlocks.size();
+
+	return HashChunk(blocks, structureBlocks);
+}
+
+static RegionHashes GenerateRegionSingleThreaded(const std::vector<glm::ivec3>& chunkPositions)
+{
+	HeightmapCache heightmapCache(s_Seed, s_HeightmapCacheCapacity);
+	RegionHashes regionHashes;
+
+	for (const auto& chunkPosition : chunkPositions)
+	{
+		size_t structureBlockCount = 0;
+		regionHashes.chunkHashes.push_back(GenerateChunkHash(chunkPosition, heightmapCache, structureBlockCount));
+		regionHashes.structureBlockCount += structureBlockCount;
+	}
+
+	return regionHashes;
+}
+
+static RegionHashes GenerateRegionMultiThreaded(const std::vector<glm::ivec3>& chunkPositions, const unsigned int workerCount)
+{
+	HeightmapCache heightmapCache(s_Seed, s_HeightmapCacheCapacity);
+	std::vector<std::uint64_t> chunkHashes(chunkPositions.size(), 0u);
+	std::vector<size_t> structureBlockCounts(chunkPositions.size(), 0u);
+
+	{
+		ThreadPool workerThreads(workerCount);
+
+		for (size_t i = 0; i < chunkPositions.size(); ++i)
+		{
+			workerThreads.Enqueue([&, i]()
+			{
+				chunkHashes[i] = GenerateChunkHash(chunkPositions[i], heightmapCache, structureBlockCounts[i]);
+			});
+		}
+
+		workerThreads.WaitForJobs();
+	}
+
+	RegionHashes regionHashes{ std::move(chunkHashes), 0 };
+
+	for (const size_t structureBlockCount : structureBlockCounts)
+	{
+		regionHashes.structureBlockCount += structureBlockCount;
+	}
+
+	return regionHashes;
+}
+
+TEST_CASE(SingleThreadedGenerationIsRepeatable)
+{
+	const std::vector<glm::ivec3> chunkPositions = GetRegionChunkPositions();
+
+	const RegionHashes firstHashes = GenerateRegionSingleThreaded(chunkPositions);
+	const RegionHashes secondHashes = GenerateRegionSingleThreaded(chunkPositions);
+
+	CHECK(firstHashes.chunkHashes == secondHashes.chunkHashes);
+	CHECK(firstHashes.structureBlockCount > 0);
+}
+
+TEST_CASE(MultiThreadedGenerationMatchesSingleThreaded)
+{
+	const std::vector<glm::ivec3> chunkPositions = GetRegionChunkPositions();
+	const RegionHashes singleThreadedHashes = GenerateRegionSingleThreaded(chunkPositions);
+
+	for (const unsigned int workerCount : { 2u, 4u, 8u, ThreadPool::GetDefaultWorkerCount() })
+	{
+		const RegionHashes multiThreadedHashes = GenerateRegionMultiThreaded(chunkPositions, workerCount);
+
+		CHECK(multiThreadedHashes.chunkHashes == singleThreadedHashes.chunkHashes);
+		CHECK(multiThreadedHashes.structureBlockCount == singleThreadedHashes.structureBlockCount);
+	}
+}
\ No newline at end of file
@@ -0,0 +1,6 @@
+#include "Test.h"
+
+int main(int argc, char* argv[])
+{
+	return Test::RunAll();
+}
\ No newline at end of file
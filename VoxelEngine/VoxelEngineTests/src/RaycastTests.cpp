@@ -0,0 +1,165 @@
+#include <glm/glm.hpp>
+
+#include <array>
+#include <cmath>
+#include <optional>
+#include <unordered_map>
+
+#include "../../VoxelEngine/src/voxel_engine/world/Block.h"
+#include "../../VoxelEngine/src/voxel_engine/world/Chunk.h"
+#include "../../VoxelEngine/src/voxel_engine/world/ChunkMap.h"
+#include "../../VoxelEngine/src/voxel_engine/world/World.h"
+#include "Test.h"
+
+static constexpr float s_MaxDistance = 16.0f;
+static constexpr float s_DistanceTolerance = 0.0001f;
+
+// Stores blocks per chunk the same way World does, so that rays cross the same chunk seams and negative chunk coordinates.
+class ChunkedBlocks
+{
+private:
+	using ChunkBlocks = std::array<Block, Chunk::GetSize().x * Chunk::GetSize().y * Chunk::GetSize().z>;
+
+	std::unordered_map<glm::ivec3, ChunkBlocks, ChunkPositionHash> m_chunks;
+
+public:
+	void SetBlockAt(const glm::ivec3& position, const Block block)
+	{
+		const glm::ivec3 chunkPosition = World::WorldCoordinatesToChunkCoordinates(position.x, position.y, position.z);
+
+		if (m_chunks.find(chunkPosition) == std::end(m_chunks))
+		{
+			m_chunks[chunkPosition].fill(Block::Air);
+		}
+
+		m_chunks[chunkPosition][GetBlockIndex(position - chunkPosition)] = block;
+	}
+
+	Block GetBlockAt(const glm::ivec3& position) const
+	{
+		const glm::ivec3 chunkPosition = World::WorldCoordinatesToChunkCoordinates(position.x, position.y, position.z);
+
+		if (const auto location = m_chunks.find(chunkPosition);
+			location != std::end(m_chunks))
+		{
+			return location->second[GetBlockIndex(position - chunkPosition)];
+		}
+
+		return Block::Air;
+	}
+
+	std::optional<World::RaycastHit> Raycast(const glm::vec3& origin, const glm::vec3& direction, const float maxDistance = s_MaxDistance) const
+	{
+		return World::Raycast(origin, direction, maxDistance, [this](const glm::ivec3& position)
+		{
+			return GetBlockAt(position);
+		});
+	}
+
+private:
+	static size_t GetBlockIndex(const glm::ivec3& localPosition)
+	{
+		CHECK(glm::all(glm::greaterThanEqual(localPosition, glm::ivec3{ 0, 0, 0 })) && glm::all(glm::lessThan(localPosition, glm::ivec3(Chunk::GetSize()))));
+
+		return localPosition.x * Chunk::GetSize().y * Chunk::GetSize().z + localPosition.y * Chunk::GetSize().z + localPosition.z;
+	}
+};
+
+static void CheckHit(const std::optional<World::RaycastHit>& hit, const glm::ivec3& blockPosition, const glm::ivec3& previousPosition, const glm::ivec3& faceNormal, const Block block, const float distance)
+{
+	CHECK(hit.has_value());
+
+	if (!hit.has_value())
+	{
+		return;
+	}
+
+	CHECK(hit->blockPosition == blockPosition);
+	CHECK(hit->previousPosition == previousPosition);
+	CHECK(hit->faceNormal == faceNormal);
+	CHECK(hit->block == block);
+	CHECK(std::abs(hit->distance - distance) < s_DistanceTolerance);
+	CHECK(hit->previousPosition == hit->blockPosition + hit->faceNormal);
+}
+
+TEST_CASE(RaycastHitsAcrossPositiveXChunkSeam)
+{
+	ChunkedBlocks blocks;
+	blocks.SetBlockAt(glm::ivec3{ 17, 40, 8 }, Block::Stone);
+
+	CheckHit(blocks.Raycast(glm::vec3{ 14.5f, 40.5f, 8.5f }, glm::vec3{ 1.0f, 0.0f, 0.0f }), glm::ivec3{ 17, 40, 8 }, glm::ivec3{ 16, 40, 8 }, glm::ivec3{ -1, 0, 0 }, Block::Stone, 2.5f);
+}
+
+TEST_CASE(RaycastHitsAcrossNegativeXChunkSeam)
+{
+	ChunkedBlocks blocks;
+	blocks.SetBlockAt(glm::ivec3{ -2, 40, 8 }, Block::Dirt);
+
+	CheckHit(blocks.Raycast(glm::vec3{ 1.5f, 40.5f, 8.5f }, glm::vec3{ -1.0f, 0.0f, 0.0f }), glm::ivec3{ -2, 40, 8 }, glm::ivec3{ -1, 40, 8 }, glm::ivec3{ 1, 0, 0 }, Block::Dirt, 2.5f);
+}
+
+TEST_CASE(RaycastHitsAcrossPositiveZChunkSeam)
+{
+	ChunkedBlocks blocks;
+	blocks.SetBlockAt(glm::ivec3{ 8, 40, 33 }, Block::Planks);
+
+	CheckHit(blocks.Raycast(glm::vec3{ 8.5f, 40.5f, 30.25f }, glm::vec3{ 0.0f, 0.0f, 1.0f }), glm::ivec3{ 8, 40, 33 }, glm::ivec3{ 8, 40, 32 }, glm::ivec3{ 0, 0, -1 }, Block::Planks, 2.75f);
+}
+
+TEST_CASE(RaycastHitsAcrossNegativeZChunkSeam)
+{
+	ChunkedBlocks blocks;
+	blocks.SetBlockAt(glm::ivec3{ 8, 40, -1 }, Block::Glass);
+
+	CheckHit(blocks.Raycast(glm::vec3{ 8.5f, 40.5f, 0.75f }, glm::vec3{ 0.0f, 0.0f, -1.0f }), glm::ivec3{ 8, 40, -1 }, glm::ivec3{ 8, 40, 0 }, glm::ivec3{ 0, 0, 1 }, Block::Glass, 0.75f);
+}
+
+TEST_CASE(RaycastHitsAcrossDiagonalChunkCorner)
+{
+	ChunkedBlocks blocks;
+	blocks.SetBlockAt(glm::ivec3{ 16, 40, 16 }, Block::Log);
+
+	CheckHit(blocks.Raycast(glm::vec3{ 15.25f, 40.5f, 15.75f }, glm::vec3{ 1.0f, 0.0f, 1.0f }), glm::ivec3{ 16, 40, 16 }, glm::ivec3{ 15, 40, 16 }, glm::ivec3{ -1, 0, 0 }, Block::Log, 0.75f * std::sqrt(2.0f));
+}
+
+TEST_CASE(RaycastHitsAtNegativeWorldCoordinates)
+{
+	ChunkedBlocks blocks;
+	blocks.SetBlockAt(glm::ivec3{ -31, 36, -18 }, Block::Grass);
+	blocks.SetBlockAt(glm::ivec3{ -17, 40, -33 }, Block::Cobblestone);
+
+	CheckHit(blocks.Raycast(glm::vec3{ -30.25f, 40.5f, -17.75f }, glm::vec3{ 0.0f, -1.0f, 0.0f }), glm::ivec3{ -31, 36, -18 }, glm::ivec3{ -31, 37, -18 }, glm::ivec3{ 0, 1, 0 }, Block::Grass, 3.5f);
+	CheckHit(blocks.Raycast(glm::vec3{ -16.5f, 40.5f, -30.5f }, glm::vec3{ 0.0f, 0.0f, -1.0f }), glm::ivec3{ -17, 40, -33 }, glm::ivec3{ -17, 40, -32 }, glm::ivec3{ 0, 0, 1 }, Block::Cobblestone, 1.5f);
+}
+
+TEST_CASE(RaycastStartingInsideBlockHitsThatBlock)
+{
+	ChunkedBlocks blocks;
+	blocks.SetBlockAt(glm::ivec3{ -1, 40, -1 }, Block::Stone);
+
+	const std::optional<World::RaycastHit> hit = blocks.Raycast(glm::vec3{ -0.5f, 40.5f, -0.5f }, glm::vec3{ 1.0f, 0.0f, 0.0f });
+	CHECK(hit.has_value() && hit->blockPosition == glm::ivec3(-1, 40, -1) && hit->previousPosition == hit->blockPosition);
+	CHECK(hit.has_value() && hit->faceNormal == glm::ivec3(0, 0, 0) && hit->distance == 0.0f);
+}
+
+TEST_CASE(RaycastIgnoresDirectionLength)
+{
+	ChunkedBlocks blocks;
+	blocks.SetBlockAt(glm::ivec3{ 8, 20, 8 }, Block::Stone);
+
+	CheckHit(blocks.Raycast(glm::vec3{ 8.5f, 25.5f, 8.5f }, glm::vec3{ 0.0f, -10.0f, 0.0f }), glm::ivec3{ 8, 20, 8 }, glm::ivec3{ 8, 21, 8 }, glm::ivec3{ 0, 1, 0 }, Block::Stone, 4.5f);
+}
+
+TEST_CASE(RaycastMissesBeyondMaxDistance)
+{
+	ChunkedBlocks blocks;
+	blocks.SetBlockAt(glm::ivec3{ -11, 40, 8 }, Block::Stone);
+
+	const glm::vec3 origin{ 0.5f, 40.5f, 8.5f };
+	const glm::vec3 direction{ -1.0f, 0.0f, 0.0f };
+
+	CHECK(!blocks.Raycast(origin, direction, 10.0f).has_value());
+	CheckHit(blocks.Raycast(origin, direction, 10.5f), glm::ivec3{ -11, 40, 8 }, glm::ivec3{ -10, 40, 8 }, glm::ivec3{ 1, 0, 0 }, Block::Stone, 10.5f);
+	CHECK(!blocks.Raycast(origin, glm::vec3{ 1.0f, 0.0f, 0.0f }).has_value());
+	CHECK(!blocks.Raycast(origin, glm::vec3{ 0.0f, 0.0f, 0.0f }).has_value());
+}
\ No newline at end of file
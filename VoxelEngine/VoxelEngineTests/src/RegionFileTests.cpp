@@ -0,0 +1,114 @@
+#include <glm/glm.hpp>
+#include <magic_enum/magic_enum.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <optional>
+#include <string>
+#include <system_error>
+#include <vector>
+
+#include "../../VoxelEngine/src/voxel_engine/world/Block.h"
+#include "../../VoxelEngine/src/voxel_engine/world/RegionFile.h"
+#include "Test.h"
+
+static constexpr unsigned int s_RegionChunkHeight = 1u;
+static constexpr size_t s_RegionBlockCount = 16u * 16u * 16u;
+
+static std::string GetTestRegionFilePath()
+{
+	const std::filesystem::path directory = std::filesystem::temp_directory_path() / "voxel_engine_tests";
+
+	std::error_code errorCode;
+	std::filesystem::create_directories(directory, errorCode);
+	std::filesystem::remove(directory / "region.0.0.dat", errorCode);
+
+	return (directory / "region.0.0.dat").string();
+}
+
+TEST_CASE(DecompressBlocksRejectsOutOfRangePaletteID)
+{
+	// One palette entry one past the last Block, followed by a single run that covers the whole chunk.
+	const std::vector<std::uint8_t> data{ 1u, static_cast<std::uint8_t>(magic_enum::enum_count<Block>()), 0x80u, 0x20u, 0u };
+	size_t position = 0;
+
+	CHECK(!RegionFile::DecompressBlocks(data, s_RegionBlockCount, position).has_value());
+}
+
+TEST_CASE(DecompressBlocksAcceptsLastBlock)
+{
+	const Block lastBlock = magic_enum::enum_values<Block>().back();
+	const std::vector<std::uint8_t> data{ 1u, static_cast<std::uint8_t>(lastBlock), 0x80u, 0x20u, 0u };
+	size_t position = 0;
+
+	const std::optional<std::vector<Block>> blocks = RegionFile::DecompressBlocks(data, s_RegionBlockCount, position);
+
+	CHECK(blocks.has_value());
+	CHECK(blocks.has_value() && blocks->size() == s_RegionBlockCount && blocks->front() == lastBlock);
+}
+
+TEST_CASE(ReadChunkRejectsCorruptPalette)
+{
+	const std::string filePath = GetTestRegionFilePath();
+	const glm::ivec3 localChunkPosition{ 0, 0, 0 };
+
+	{
+		RegionFile regionFile(filePath, s_RegionChunkHeight);
+
+		CHECK(regionFile.WriteChunk(localChunkPosition, RegionFile::ChunkData{ std::vector<Block>(s_RegionBlockCount, Block::Stone), 0u }));
+		CHECK(regionFile.ReadChunk(localChunkPosition, s_RegionBlockCount).has_value());
+	}
+
+	// The first payload starts right after the header fields and the offset table, and its palette entry follows the palette size.
+	const std::streamoff headerSize = static_cast<std::streamoff>(4u * sizeof(std::uint32_t) + RegionFile::s_RegionSize * RegionFile::s_RegionSize * s_RegionChunkHeight * 2u * sizeof(std::uint32_t));
+
+	{
+		std::fstream file(filePath, std::ios_base::in | std::ios_base::out | std::ios_base::binary);
+		file.seekp(headerSize + 1);
+		file.put(static_cast<char>(0x7F));
+
+		CHECK(static_cast<bool>(file));
+	}
+
+	RegionFile regionFile(filePath, s_RegionChunkHeight);
+
+	CHECK(regionFile.IsOpen());
+	CHECK(!regionFile.ReadChunk(localChunkPosition, s_RegionBlockCount).has_value());
+}
+
+TEST_CASE(RewrittenChunkAlternatesBetweenTwoPayloads)
+{
+	const std::string filePath = GetTestRegionFilePath();
+	const glm::ivec3 localChunkPosition{ 1, 0, 2 };
+	const std::vector<Block> stoneBlocks(s_RegionBlockCount, Block::Stone);
+	const std::vector<Block> dirtBlocks(s_RegionBlockCount, Block::Dirt);
+
+	{
+		RegionFile regionFile(filePath, s_RegionChunkHeight);
+
+		CHECK(regionFile.WriteChunk(localChunkPosition, RegionFile::ChunkData{ stoneBlocks, 0u }));
+	}
+
+	const std::uintmax_t firstFileSize = std::filesystem::file_size(filePath);
+
+	// Each rewrite goes next to the live payload, so the file holds at most two copies of a same-sized chunk.
+	for (unsigned int i = 0; i < 4u; ++i)
+	{
+		{
+			RegionFile regionFile(filePath, s_RegionChunkHeight);
+
+			CHECK(regionFile.WriteChunk(localChunkPosition, RegionFile::ChunkData{ i % 2u == 0u ? dirtBlocks : stoneBlocks, i }));
+		}
+
+		RegionFile regionFile(filePath, s_RegionChunkHeight);
+		const std::optional<RegionFile::ChunkData> chunkData = regionFile.ReadChunk(localChunkPosition, s_RegionBlockCount);
+
+		CHECK(chunkData.has_value() && chunkData->blocks == (i % 2u == 0u ? dirtBlocks : stoneBlocks) && chunkData->appliedStructureSources == i);
+	}
+
+	const std::uintmax_t headerSize = 4u * sizeof(std::uint32_t) + RegionFile::s_RegionSize * RegionFile::s_RegionSize * s_RegionChunkHeight * 2u * sizeof(std::uint32_t);
+
+	CHECK(std::filesystem::file_size(filePath) == firstFileSize + (firstFileSize - headerSize));
+}
\ No newline at end of file
@@ -0,0 +1,86 @@
+#include <glm/glm.hpp>
+
+#include <cstddef>
+#include <filesystem>
+#include <fstream>
+#include <optional>
+#include <string>
+#include <system_error>
+#include <vector>
+
+#include "../../VoxelEngine/src/voxel_engine/world/Block.h"
+#include "../../VoxelEngine/src/voxel_engine/world/RegionFile.h"
+#include "../../VoxelEngine/src/voxel_engine/world/RegionStorage.h"
+#include "Test.h"
+
+static constexpr unsigned int s_StorageChunkHeight = 2u;
+static constexpr size_t s_StorageBlockCount = 16u * 16u * 16u;
+static constexpr int s_StorageRegionCount = 24;
+
+static std::string GetTestSaveDirectory()
+{
+	const std::filesystem::path directory = std::filesystem::temp_directory_path() / "voxel_engine_tests" / "storage";
+
+	std::error_code errorCode;
+	std::filesystem::remove_all(directory, errorCode);
+
+	return directory.string();
+}
+
+static glm::ivec3 GetRegionChunkIndex(const int region)
+{
+	return glm::ivec3{ (region - s_StorageRegionCount / 2) * RegionFile::s_RegionSize + 3, 1, -5 };
+}
+
+TEST_CASE(RegionStorageReopensEvictedRegionFiles)
+{
+	const std::string saveDirectory = GetTestSaveDirectory();
+	RegionStorage regionStorage(saveDirectory, s_StorageChunkHeight, s_StorageBlockCount);
+
+	// More regions than the storage keeps open, so the first ones are closed again before they are read back.
+	for (int region = 0; region < s_StorageRegionCount; ++region)
+	{
+		regionStorage.SaveChunk(GetRegionChunkIndex(region), RegionFile::ChunkData{ std::vector<Block>(s_StorageBlockCount, region % 2 == 0 ? Block::Stone : Block::Planks), static_cast<unsigned int>(region) });
+	}
+
+	for (int region = 0; region < s_StorageRegionCount; ++region)
+	{
+		const std::optional<RegionFile::ChunkData> chunkData = regionStorage.LoadChunk(GetRegionChunkIndex(region));
+
+		CHECK(chunkData.has_value() && chunkData->blocks.front() == (region % 2 == 0 ? Block::Stone : Block::Planks) && chunkData->appliedStructureSources == static_cast<unsigned int>(region));
+	}
+
+	CHECK(!regionStorage.LoadChunk(GetRegionChunkIndex(0) + glm::ivec3{ 1, 0, 0 }).has_value());
+}
+
+TEST_CASE(RegionStorageKeepsSeedAcrossReloads)
+{
+	const std::string saveDirectory = GetTestSaveDirectory();
+	unsigned int seed = 0;
+
+	{
+		const RegionStorage regionStorage(saveDirectory, s_StorageChunkHeight, s_StorageBlockCount);
+		seed = regionStorage.GetSeed();
+
+		CHECK(regionStorage.CanSaveChunks());
+	}
+
+	const RegionStorage regionStorage(saveDirectory, s_StorageChunkHeight, s_StorageBlockCount);
+
+	CHECK(regionStorage.CanSaveChunks());
+	CHECK(regionStorage.GetSeed() == seed);
+}
+
+TEST_CASE(RegionStorageSavesNothingWithoutSeedFile)
+{
+	// A plain file where the save directory should be makes both the directory and its seed file impossible to create.
+	const std::filesystem::path blockingFilePath = std::filesystem::path(GetTestSaveDirectory()) / "blocked";
+	std::filesystem::create_directories(blockingFilePath.parent_path());
+	std::ofstream(blockingFilePath).put('\0');
+
+	RegionStorage regionStorage((blockingFilePath / "save").string(), s_StorageChunkHeight, s_StorageBlockCount);
+	regionStorage.SaveChunk(GetRegionChunkIndex(0), RegionFile::ChunkData{ std::vector<Block>(s_StorageBlockCount, Block::Stone), 0u });
+
+	CHECK(!regionStorage.CanSaveChunks());
+	CHECK(!regionStorage.LoadChunk(GetRegionChunkIndex(0)).has_value());
+}
\ No newline at end of file
@@ -0,0 +1,60 @@
+#include "Test.h"
+
+#include <cstdlib>
+#include <exception>
+#include <iostream>
+
+bool Test::Register(const std::string_view name, const Function function)
+{
+	GetCases().push_back(Case{ name, function });
+
+	return true;
+}
+
+void Test::Check(const bool condition, const std::string_view expression, const std::string_view file, const int line)
+{
+	if (!condition)
+	{
+		++s_failedCheckCount;
+		std::cout << "    " << file << "(" << line << "): check failed: " << expression << "\n";
+	}
+}
+
+int Test::RunAll()
+{
+	size_t failedCaseCount = 0;
+
+	for (const auto& [name, function] : GetCases())
+	{
+		const size_t previousFailedCheckCount = s_failedCheckCount;
+
+		try
+		{
+			function();
+		}
+		catch (const std::exception& error)
+		{
+			++s_failedCheckCount;
+			std::cout << "    unexpected exception: " << error.what() << "\n";
+		}
+
+		const bool hasPassed = s_failedCheckCount == previousFailedCheckCount;
+		std::cout << (hasPassed ? "[ PASS ] " : "[ FAIL ] ") << name << std::endl;
+
+		if (!hasPassed)
+		{
+			++failedCaseCount;
+		}
+	}
+
+	std::cout << GetCases().size() - failedCaseCount << "/" << GetCases().size() << " test cases passed" << std::endl;
+
+	return failedCaseCount == 0 ? EXIT_SUCCESS : EXIT_FAILURE;
+}
+
+std::vector<Test::Case>& Test::GetCases()
+{
+	static std::vector<Case> cases;
+
+	return cases;
+}
\ No newline at end of file
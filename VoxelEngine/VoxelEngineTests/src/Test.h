@@ -0,0 +1,39 @@
+#pragma once
+#ifndef TEST_H
+#define TEST_H
+
+#include <cstddef>
+#include <string_view>
+#include <vector>
+
+class Test
+{
+public:
+	using Function = void(*)();
+
+private:
+	struct Case
+	{
+		std::string_view name;
+		Function function;
+	};
+
+	inline static size_t s_failedCheckCount = 0;
+
+public:
+	Test() = delete;
+	~Test() noexcept = delete;
+
+	static bool Register(const std::string_view name, const Function function);
+	static void Check(const bool condition, const std::string_view expression, const std::string_view file, const int line);
+
+	static int RunAll();
+
+private:
+	static std::vector<Case>& GetCases();
+};
+
+#define TEST_CASE(name) static void name(); static const bool name##IsRegistered = Test::Register(#name, name); static void name()
+#define CHECK(condition) Test::Check(static_cast<bool>(condition), #condition, __FILE__, __LINE__)
+
+#endif
\ No newline at end of file